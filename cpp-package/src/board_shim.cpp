@@ -126,6 +126,16 @@ void BoardShim::start_stream (int buffer_size, char *streamer_params)
     }
 }
 
+void BoardShim::set_buffer_layout (int layout)
+{
+    int res =
+        ::set_buffer_layout (layout, board_id, const_cast<char *> (serialized_params.c_str ()));
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to set buffer layout", res);
+    }
+}
+
 void BoardShim::stop_stream ()
 {
     int res = ::stop_stream (board_id, const_cast<char *> (serialized_params.c_str ()));
@@ -203,6 +213,51 @@ double **BoardShim::get_current_board_data (int num_samples, int *num_data_point
     return output_buf;
 }
 
+int BoardShim::create_reader ()
+{
+    int reader_id = 0;
+    int res =
+        ::create_reader (&reader_id, board_id, const_cast<char *> (serialized_params.c_str ()));
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create reader", res);
+    }
+    return reader_id;
+}
+
+double **BoardShim::read_new_samples (int reader_id, int max_samples, int *num_data_points)
+{
+    int num_data_channels = BoardShim::get_num_rows (get_board_id ());
+    double *buf = new double[max_samples * num_data_channels];
+    int res = ::read_new_samples (reader_id, max_samples, buf, num_data_points, board_id,
+        const_cast<char *> (serialized_params.c_str ()));
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] buf;
+        throw BrainFlowException ("failed to read new samples", res);
+    }
+
+    double **output_buf = new double *[num_data_channels];
+    for (int i = 0; i < num_data_channels; i++)
+    {
+        output_buf[i] = new double[*num_data_points];
+    }
+    reshape_data (*num_data_points, buf, output_buf);
+    delete[] buf;
+
+    return output_buf;
+}
+
+void BoardShim::release_reader (int reader_id)
+{
+    int res =
+        ::release_reader (reader_id, board_id, const_cast<char *> (serialized_params.c_str ()));
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release reader", res);
+    }
+}
+
 std::string BoardShim::config_board (char *config)
 {
     int response_len = 0;
@@ -217,6 +272,20 @@ std::string BoardShim::config_board (char *config)
     return resp;
 }
 
+std::string BoardShim::get_board_stats ()
+{
+    int stats_len = 0;
+    char stats[8192];
+    int res = ::get_board_stats (
+        stats, &stats_len, board_id, const_cast<char *> (serialized_params.c_str ()));
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get board stats", res);
+    }
+    std::string board_stats ((const char *)stats, stats_len);
+    return board_stats;
+}
+
 // for better user experience and consistency accross bindings we return 2d array from user api, we
 // can not do it directly in low level api because some languages can not pass multidim array to C++
 void BoardShim::reshape_data (int num_data_points, double *linear_buffer, double **output_buf)
@@ -48,6 +48,126 @@ void DataFilter::perform_bandstop (double *data, int data_len, int sampling_rate
     }
 }
 
+// rows of 2d array in cpp package are not contiguous, copy selected channels to a single matrix
+static double *copy_channels (double **data, int cols, int *channels, int channels_len)
+{
+    if ((data == NULL) || (channels == NULL) || (channels_len < 1) || (cols < 1))
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    double *data_1d = new double[cols * channels_len];
+    for (int i = 0; i < channels_len; i++)
+    {
+        memcpy (data_1d + i * cols, data[channels[i]], sizeof (double) * cols);
+    }
+    return data_1d;
+}
+
+static void perform_filter_multi (int filter_operation, double **data, int cols, int *channels,
+    int channels_len, int sampling_rate, double freq, double band_width, int order,
+    int filter_type, double ripple)
+{
+    double *data_1d = copy_channels (data, cols, channels, channels_len);
+    int *rows = new int[channels_len];
+    for (int i = 0; i < channels_len; i++)
+    {
+        rows[i] = i;
+    }
+    int res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    switch (static_cast<FilterOperations> (filter_operation))
+    {
+        case FilterOperations::LOWPASS:
+            res = ::perform_lowpass_multi (data_1d, channels_len, cols, rows, channels_len,
+                sampling_rate, freq, order, filter_type, ripple);
+            break;
+        case FilterOperations::HIGHPASS:
+            res = ::perform_highpass_multi (data_1d, channels_len, cols, rows, channels_len,
+                sampling_rate, freq, order, filter_type, ripple);
+            break;
+        case FilterOperations::BANDPASS:
+            res = ::perform_bandpass_multi (data_1d, channels_len, cols, rows, channels_len,
+                sampling_rate, freq, band_width, order, filter_type, ripple);
+            break;
+        case FilterOperations::BANDSTOP:
+            res = ::perform_bandstop_multi (data_1d, channels_len, cols, rows, channels_len,
+                sampling_rate, freq, band_width, order, filter_type, ripple);
+            break;
+    }
+    delete[] rows;
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] data_1d;
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+    for (int i = 0; i < channels_len; i++)
+    {
+        memcpy (data[channels[i]], data_1d + i * cols, sizeof (double) * cols);
+    }
+    delete[] data_1d;
+}
+
+void DataFilter::perform_lowpass_multi (double **data, int cols, int *channels, int channels_len,
+    int sampling_rate, double cutoff, int order, int filter_type, double ripple)
+{
+    perform_filter_multi ((int)FilterOperations::LOWPASS, data, cols, channels, channels_len,
+        sampling_rate, cutoff, 0.0, order, filter_type, ripple);
+}
+
+void DataFilter::perform_highpass_multi (double **data, int cols, int *channels, int channels_len,
+    int sampling_rate, double cutoff, int order, int filter_type, double ripple)
+{
+    perform_filter_multi ((int)FilterOperations::HIGHPASS, data, cols, channels, channels_len,
+        sampling_rate, cutoff, 0.0, order, filter_type, ripple);
+}
+
+void DataFilter::perform_bandpass_multi (double **data, int cols, int *channels, int channels_len,
+    int sampling_rate, double center_freq, double band_width, int order, int filter_type,
+    double ripple)
+{
+    perform_filter_multi ((int)FilterOperations::BANDPASS, data, cols, channels, channels_len,
+        sampling_rate, center_freq, band_width, order, filter_type, ripple);
+}
+
+void DataFilter::perform_bandstop_multi (double **data, int cols, int *channels, int channels_len,
+    int sampling_rate, double center_freq, double band_width, int order, int filter_type,
+    double ripple)
+{
+    perform_filter_multi ((int)FilterOperations::BANDSTOP, data, cols, channels, channels_len,
+        sampling_rate, center_freq, band_width, order, filter_type, ripple);
+}
+
+int DataFilter::create_filter (int filter_operation, int sampling_rate, double freq,
+    double band_width, int order, int filter_type, double ripple)
+{
+    int filter_id = 0;
+    int res = ::create_filter (filter_operation, sampling_rate, freq, band_width, order,
+        filter_type, ripple, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+void DataFilter::process_filter (int filter_id, double *data, int data_len)
+{
+    int res = ::process_filter (filter_id, data, data_len);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::release_filter (int filter_id)
+{
+    int res = ::release_filter (filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release filter", res);
+    }
+}
+
 void DataFilter::perform_rolling_filter (double *data, int data_len, int period, int agg_operation)
 {
     int res = ::perform_rolling_filter (data, data_len, period, agg_operation);
@@ -57,6 +177,35 @@ void DataFilter::perform_rolling_filter (double *data, int data_len, int period,
     }
 }
 
+int DataFilter::create_rolling_filter (int period, int agg_operation)
+{
+    int filter_id = 0;
+    int res = ::create_rolling_filter (period, agg_operation, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+void DataFilter::process_rolling_filter (int filter_id, double *data, int data_len)
+{
+    int res = ::process_rolling_filter (filter_id, data, data_len);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::release_rolling_filter (int filter_id)
+{
+    int res = ::release_rolling_filter (filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release filter", res);
+    }
+}
+
 double *DataFilter::perform_downsampling (
     double *data, int data_len, int period, int agg_operation, int *filtered_size)
 {
@@ -75,6 +224,36 @@ double *DataFilter::perform_downsampling (
     return filtered_data;
 }
 
+double *DataFilter::perform_resampling (
+    double *data, int data_len, int input_rate, int output_rate, int *output_len)
+{
+    int res = ::get_resampled_len (data_len, input_rate, output_rate, output_len);
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) || (*output_len == 0))
+    {
+        throw BrainFlowException (
+            "invalid input params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    double *resampled_data = new double[*output_len];
+    res = ::perform_resampling (data, data_len, input_rate, output_rate, resampled_data);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] resampled_data;
+        throw BrainFlowException ("failed to resample signal", res);
+    }
+    return resampled_data;
+}
+
+int DataFilter::get_resampled_len (int data_len, int input_rate, int output_rate)
+{
+    int output_len = 0;
+    int res = ::get_resampled_len (data_len, input_rate, output_rate, &output_len);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to calc resampled len", res);
+    }
+    return output_len;
+}
+
 std::pair<double *, int *> DataFilter::perform_wavelet_transform (
     double *data, int data_len, char *wavelet, int decomposition_level)
 {
@@ -126,6 +305,30 @@ void DataFilter::perform_wavelet_denoising (
     }
 }
 
+void DataFilter::perform_wavelet_denoising_multi (double **data, int cols, int *channels,
+    int channels_len, char *wavelet, int decomposition_level)
+{
+    double *data_1d = copy_channels (data, cols, channels, channels_len);
+    int *rows = new int[channels_len];
+    for (int i = 0; i < channels_len; i++)
+    {
+        rows[i] = i;
+    }
+    int res = ::perform_wavelet_denoising_multi (
+        data_1d, channels_len, cols, rows, channels_len, wavelet, decomposition_level);
+    delete[] rows;
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] data_1d;
+        throw BrainFlowException ("failed to perform wavelet denoising", res);
+    }
+    for (int i = 0; i < channels_len; i++)
+    {
+        memcpy (data[channels[i]], data_1d + i * cols, sizeof (double) * cols);
+    }
+    delete[] data_1d;
+}
+
 std::complex<double> *DataFilter::perform_fft (double *data, int data_len, int window)
 {
     if ((data_len & (data_len - 1)) || (data_len <= 0))
@@ -206,6 +409,43 @@ std::pair<double *, double *> DataFilter::get_psd_welch (
     return std::make_pair (ampl, freq);
 }
 
+std::pair<double **, double *> DataFilter::get_psd_welch_multi (double **data, int cols,
+    int *channels, int channels_len, int nfft, int overlap, int sampling_rate, int window)
+{
+    if ((nfft & (nfft - 1)) || (nfft <= 0))
+    {
+        throw BrainFlowException (
+            "nfft is not power of 2", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    double *data_1d = copy_channels (data, cols, channels, channels_len);
+    int *rows = new int[channels_len];
+    for (int i = 0; i < channels_len; i++)
+    {
+        rows[i] = i;
+    }
+    int psd_len = nfft / 2 + 1;
+    double *ampl_1d = new double[psd_len * channels_len];
+    double *freq = new double[psd_len];
+    int res = ::get_psd_welch_multi (data_1d, channels_len, cols, rows, channels_len, nfft,
+        overlap, sampling_rate, window, ampl_1d, freq);
+    delete[] data_1d;
+    delete[] rows;
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] ampl_1d;
+        delete[] freq;
+        throw BrainFlowException ("failed to get_psd_welch", res);
+    }
+    double **ampl = new double *[channels_len];
+    for (int i = 0; i < channels_len; i++)
+    {
+        ampl[i] = new double[psd_len];
+        memcpy (ampl[i], ampl_1d + i * psd_len, sizeof (double) * psd_len);
+    }
+    delete[] ampl_1d;
+    return std::make_pair (ampl, freq);
+}
+
 std::pair<double *, double *> DataFilter::get_avg_band_powers (
     double **data, int cols, int *channels, int channels_len, int sampling_rate, bool apply_filters)
 {
@@ -320,6 +560,58 @@ double **DataFilter::read_file (int *num_rows, int *num_cols, char *file_name)
     return output_buf;
 }
 
+int DataFilter::create_band_power_tracker (
+    int channels_len, int sampling_rate, int window_size, bool apply_filters)
+{
+    int tracker_id = 0;
+    int res = ::create_band_power_tracker (
+        channels_len, sampling_rate, window_size, (int)apply_filters, &tracker_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create band power tracker", res);
+    }
+    return tracker_id;
+}
+
+void DataFilter::add_band_power_tracker_data (
+    int tracker_id, double **data, int cols, int *channels, int channels_len)
+{
+    if (cols == 0)
+    {
+        return;
+    }
+    double *data_1d = copy_channels (data, cols, channels, channels_len);
+    int res = ::add_band_power_tracker_data (tracker_id, data_1d, channels_len, cols);
+    delete[] data_1d;
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to add data to band power tracker", res);
+    }
+}
+
+std::pair<double *, double *> DataFilter::get_band_power_tracker_values (int tracker_id)
+{
+    double *avg_bands = new double[5];
+    double *stddev_bands = new double[5];
+    int res = ::get_band_power_tracker_values (tracker_id, avg_bands, stddev_bands);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] avg_bands;
+        delete[] stddev_bands;
+        throw BrainFlowException ("failed to get band powers", res);
+    }
+    return std::make_pair (avg_bands, stddev_bands);
+}
+
+void DataFilter::release_band_power_tracker (int tracker_id)
+{
+    int res = ::release_band_power_tracker (tracker_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release band power tracker", res);
+    }
+}
+
 void DataFilter::write_file (
     double **data, int num_rows, int num_cols, char *file_name, char *file_mode)
 {
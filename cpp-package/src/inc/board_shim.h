@@ -165,10 +165,15 @@ public:
      * start streaming thread and store data in ringbuffer
      * @param buffer_size size of internal ring buffer
      * @param streamer_params use it to pass data packages further or store them directly during streaming,
-                    supported values: "file://%file_name%:w", "file://%file_name%:a", "streaming_board://%multicast_group_ip%:%port%"".
-                    Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
+                    supported values: "file://%file_name%:w", "file://%file_name%:a", "file://%file_name%:wb"(binary doubles, "ab" to append, "wbf"/"abf" for floats), "streaming_board://%multicast_group_ip%:%port%" or "streaming_board://%multicast_group_ip%:%port%:%batch_size%" (batch_size > 1 sends several samples per datagram with a versioned header, receiver should use BrainFlow with the same format version)".
+                    Several streamers can be separated by ";". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
      */
     void start_stream (int buffer_size = 450000, char *streamer_params = NULL);
+    /**
+     * set layout of internal ring buffer, applied in the next start_stream call
+     * @param layout BufferLayouts::INTERLEAVED (default) or BufferLayouts::BY_CHANNELS, with BY_CHANNELS each channel is stored contiguously and reading data is faster
+     */
+    void set_buffer_layout (int layout);
     /// check if session is ready or not
     bool is_prepared ();
     /// stop streaming thread, doesnt release other resources
@@ -183,7 +188,15 @@ public:
     int get_board_data_count ();
     /// get all collected data and flush it from internal buffer
     double **get_board_data (int *num_data_points);
+    /// create non destructive reader which gets only samples collected after its creation
+    int create_reader ();
+    /// get samples collected since the previous call for this reader, doesnt remove them from ringbuffer
+    double **read_new_samples (int reader_id, int max_samples, int *num_data_points);
+    /// release reader created by create_reader
+    void release_reader (int reader_id);
     /// send string to a board, use it carefully and only if you understand what you are doing
     std::string config_board (char *config);
+    /// get json with counters of lost, duplicated and broken packages and timing jitter
+    std::string get_board_stats ();
     // clang-format on
 };
@@ -19,6 +19,8 @@ public:
     static void enable_dev_data_logger ();
 
     static void set_log_file (char *log_file);
+    /// set number of threads used by multichannel methods, including calling thread
+    static void set_num_threads (int num_threads);
     /// perform low pass filter in-place
     static void perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff,
         int order, int filter_type, double ripple);
@@ -31,11 +33,51 @@ public:
     /// perform bandstop filter in-place
     static void perform_bandstop (double *data, int data_len, int sampling_rate, double center_freq,
         double band_width, int order, int filter_type, double ripple);
+    /**
+     * create filter which keeps its state between process_filter calls
+     * @param filter_operation value from FilterOperations enum
+     * @param freq cutoff for lowpass and highpass, center freq for bandpass and bandstop
+     * @param band_width used only for bandpass and bandstop
+     * @return filter id to use in process_filter and release_filter
+     */
+    static int create_filter (int filter_operation, int sampling_rate, double freq,
+        double band_width, int order, int filter_type, double ripple);
+    /// filter next chunk of data in-place
+    static void process_filter (int filter_id, double *data, int data_len);
+    /// release filter created by create_filter
+    static void release_filter (int filter_id);
+    // methods below apply the same filter to several rows of 2d array in-place, rows are
+    // processed in parallel
+    /// perform low pass filter for channels in-place
+    static void perform_lowpass_multi (double **data, int cols, int *channels, int channels_len,
+        int sampling_rate, double cutoff, int order, int filter_type, double ripple);
+    /// perform high pass filter for channels in-place
+    static void perform_highpass_multi (double **data, int cols, int *channels, int channels_len,
+        int sampling_rate, double cutoff, int order, int filter_type, double ripple);
+    /// perform bandpass filter for channels in-place
+    static void perform_bandpass_multi (double **data, int cols, int *channels, int channels_len,
+        int sampling_rate, double center_freq, double band_width, int order, int filter_type,
+        double ripple);
+    /// perform bandstop filter for channels in-place
+    static void perform_bandstop_multi (double **data, int cols, int *channels, int channels_len,
+        int sampling_rate, double center_freq, double band_width, int order, int filter_type,
+        double ripple);
     /// perform moving average or moving median filter in-place
     static void perform_rolling_filter (double *data, int data_len, int period, int agg_operation);
+    /// create moving average or moving median filter which keeps its window between calls
+    static int create_rolling_filter (int period, int agg_operation);
+    /// filter next chunk of data in-place
+    static void process_rolling_filter (int filter_id, double *data, int data_len);
+    /// release filter created by create_rolling_filter
+    static void release_rolling_filter (int filter_id);
     /// perform data downsampling, it just aggregates several data points
     static double *perform_downsampling (
         double *data, int data_len, int period, int agg_operation, int *filtered_size);
+    /// convert data to another sampling rate using polyphase filter
+    static double *perform_resampling (
+        double *data, int data_len, int input_rate, int output_rate, int *output_len);
+    /// get number of output samples for perform_resampling
+    static int get_resampled_len (int data_len, int input_rate, int output_rate);
     // clang-format off
     /**
      * perform wavelet transform
@@ -58,6 +100,9 @@ public:
     /// perform wavelet denoising
     static void perform_wavelet_denoising (
         double *data, int data_len, char *wavelet, int decomposition_level);
+    /// perform wavelet denoising for channels in-place, channels are processed in parallel
+    static void perform_wavelet_denoising_multi (double **data, int cols, int *channels,
+        int channels_len, char *wavelet, int decomposition_level);
     /**
      * perform direct fft
      * @param data input array
@@ -98,6 +143,16 @@ public:
     static void detrend (double *data, int data_len, int detrend_operation);
     static std::pair<double *, double *> get_psd_welch (
         double *data, int data_len, int nfft, int overlap, int sampling_rate, int window);
+    /**
+     * calculate welch psd for several channels in parallel
+     * @param data input 2d array
+     * @param cols number of cols in 2d array - number of datapoints
+     * @param channels array of rows which should be used
+     * @param channels_len - len of channels array
+     * @return pair of 2d array of amplitudes(channels_len rows, nfft / 2 + 1 cols) and freq array
+     */
+    static std::pair<double **, double *> get_psd_welch_multi (double **data, int cols,
+        int *channels, int channels_len, int nfft, int overlap, int sampling_rate, int window);
     /**
      * calculate band power
      * @param psd psd calculated using get_psd
@@ -120,6 +175,22 @@ public:
      */
     static std::pair<double *, double *> get_avg_band_powers (double **data, int cols,
         int *channels, int channels_len, int sampling_rate, bool apply_filters);
+    /**
+     * create tracker which calculates the same values as get_avg_band_powers for the latest window
+     * but processes each new sample only once
+     * @param channels_len number of channels which will be added to tracker
+     * @param window_size number of datapoints in window
+     * @return tracker id
+     */
+    static int create_band_power_tracker (
+        int channels_len, int sampling_rate, int window_size, bool apply_filters);
+    /// add new datapoints of channels to tracker, channels_len must be the same as in constructor
+    static void add_band_power_tracker_data (
+        int tracker_id, double **data, int cols, int *channels, int channels_len);
+    /// get avg and stddev of band powers for the latest window, arrays of size 5
+    static std::pair<double *, double *> get_band_power_tracker_values (int tracker_id);
+    /// release tracker created by create_band_power_tracker
+    static void release_band_power_tracker (int tracker_id);
 
     /// write file, in file data will be transposed
     static void write_file (
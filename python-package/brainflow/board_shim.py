@@ -61,6 +61,13 @@ class IpProtocolType (enum.Enum):
     TCP = 2 #:
 
 
+class BufferLayouts (enum.Enum):
+    """Enum to store layouts of internal ring buffer"""
+
+    INTERLEAVED = 0 #:
+    BY_CHANNELS = 1 #:
+
+
 class BrainFlowInputParams (object):
     """ inputs parameters for prepare_session method
 
@@ -168,6 +175,14 @@ class BoardControllerDLL (object):
             ctypes.c_char_p
         ]
 
+        self.set_buffer_layout = self.lib.set_buffer_layout
+        self.set_buffer_layout.restype = ctypes.c_int
+        self.set_buffer_layout.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
         self.stop_stream = self.lib.stop_stream
         self.stop_stream.restype = ctypes.c_int
         self.stop_stream.argtypes = [
@@ -209,6 +224,33 @@ class BoardControllerDLL (object):
             ctypes.c_char_p
         ]
 
+        self.create_reader = self.lib.create_reader
+        self.create_reader.restype = ctypes.c_int
+        self.create_reader.argtypes = [
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.read_new_samples = self.lib.read_new_samples
+        self.read_new_samples.restype = ctypes.c_int
+        self.read_new_samples.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_double),
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.release_reader = self.lib.release_reader
+        self.release_reader.restype = ctypes.c_int
+        self.release_reader.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
         self.set_log_level = self.lib.set_log_level
         self.set_log_level.restype = ctypes.c_int
         self.set_log_level.argtypes = [
@@ -238,6 +280,15 @@ class BoardControllerDLL (object):
             ctypes.c_char_p
         ]
 
+        self.get_board_stats = self.lib.get_board_stats
+        self.get_board_stats.restype = ctypes.c_int
+        self.get_board_stats.argtypes = [
+            ndpointer (ctypes.c_ubyte),
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
         self.get_sampling_rate = self.lib.get_sampling_rate
         self.get_sampling_rate.restype = ctypes.c_int
         self.get_sampling_rate.argtypes = [
@@ -826,7 +877,7 @@ class BoardShim (object):
 
         :param num_samples: size of ring buffer to keep data
         :type num_samples: int
-        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "streaming_board://%multicast_group_ip%:%port%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
+        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "file://%file_name%:wb" (binary doubles, "ab" to append, "wbf"/"abf" for floats), "streaming_board://%multicast_group_ip%:%port%" or "streaming_board://%multicast_group_ip%:%port%:%batch_size%" (batch_size > 1 sends several samples per datagram with a versioned header, receiver should use BrainFlow with the same format version). Several streamers can be separated by ";". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
         :type streamer_params: str
         """
 
@@ -842,6 +893,17 @@ class BoardShim (object):
         if res != BrainflowExitCodes.STATUS_OK.value:
             raise BrainFlowError ('unable to start streaming session', res)
 
+    def set_buffer_layout (self, layout: int) -> None:
+        """Set layout of internal ring buffer, applied in the next start_stream call
+
+        :param layout: value from BufferLayouts enum, with BY_CHANNELS each channel is stored contiguously and reading data is faster
+        :type layout: int
+        """
+
+        res = BoardControllerDLL.get_instance ().set_buffer_layout (layout, self.board_id, self.input_json)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to set buffer layout', res)
+
     def stop_stream (self) -> None:
         """Stop streaming data"""
 
@@ -929,6 +991,50 @@ class BoardShim (object):
 
         return data_arr.reshape (package_length, data_size)
 
+    def create_reader (self) -> int:
+        """Create non destructive reader which gets only samples collected after its creation, each reader gets every sample once and doesnt affect other readers and get_board_data
+
+        :return: reader id
+        :rtype: int
+        """
+        reader_id = numpy.zeros (1).astype (numpy.int32)
+
+        res = BoardControllerDLL.get_instance ().create_reader (reader_id, self.board_id, self.input_json)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to create reader', res)
+        return int (reader_id[0])
+
+    def read_new_samples (self, reader_id: int, max_samples: int) -> NDArray[Float64]:
+        """Get samples collected since the previous call for this reader, doesnt remove data from ringbuffer
+
+        :param reader_id: reader id from create_reader
+        :type reader_id: int
+        :param max_samples: max number of samples
+        :type max_samples: int
+        :return: new data from a board
+        :rtype: NDArray[Float64]
+        """
+        package_length = BoardShim.get_num_rows (self._master_board_id)
+        data_arr = numpy.zeros (int (max_samples * package_length)).astype (numpy.float64)
+        current_size = numpy.zeros (1).astype (numpy.int32)
+
+        res = BoardControllerDLL.get_instance ().read_new_samples (reader_id, max_samples, data_arr, current_size, self.board_id, self.input_json)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to read new samples', res)
+
+        data_arr = data_arr[0:current_size[0] * package_length].reshape (package_length, current_size[0])
+        return data_arr
+
+    def release_reader (self, reader_id: int) -> None:
+        """Release reader created by create_reader
+
+        :param reader_id: reader id
+        :type reader_id: int
+        """
+        res = BoardControllerDLL.get_instance ().release_reader (reader_id, self.board_id, self.input_json)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to release reader', res)
+
     def config_board (self, config) -> None:
         """Use this method carefully and only if you understand what you are doing, do NOT use it to start or stop streaming
 
@@ -948,3 +1054,17 @@ class BoardShim (object):
         if res != BrainflowExitCodes.STATUS_OK.value:
             raise BrainFlowError ('unable to config board', res)
         return string.tobytes ().decode ('utf-8')[0:string_len[0]]
+
+    def get_board_stats (self) -> str:
+        """Get counters of lost and broken packages and sampling jitter for the current stream
+
+        :return: json string with num_samples, num_gaps, num_lost_samples, num_duplicates, num_out_of_order, num_decode_errors, mean_interval, interval_std and max_interval
+        :rtype: str
+        """
+        string = numpy.zeros (8192).astype (numpy.ubyte)
+        string_len = numpy.zeros (1).astype (numpy.int32)
+
+        res = BoardControllerDLL.get_instance ().get_board_stats (string, string_len, self.board_id, self.input_json)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to get board stats', res)
+        return string.tobytes ().decode ('utf-8')[0:string_len[0]]
@@ -23,12 +23,22 @@ class FilterTypes (enum.Enum):
     BESSEL = 2 #:
 
 
+class FilterOperations (enum.Enum):
+    """Enum to store all supported filter operations for filter handles"""
+
+    LOWPASS = 0 #:
+    HIGHPASS = 1 #:
+    BANDPASS = 2 #:
+    BANDSTOP = 3 #:
+
+
 class AggOperations (enum.Enum):
     """Enum to store all supported aggregation operations"""
 
     MEAN = 0 #:
     MEDIAN = 1 #:
     EACH = 2 #:
+    FIR_DECIMATION = 3 #:
 
 
 class WindowFunctions (enum.Enum):
@@ -124,6 +134,111 @@ class DataHandlerDLL (object):
             ctypes.c_double
         ]
 
+        self.perform_lowpass_multi = self.lib.perform_lowpass_multi
+        self.perform_lowpass_multi.restype = ctypes.c_int
+        self.perform_lowpass_multi.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.perform_highpass_multi = self.lib.perform_highpass_multi
+        self.perform_highpass_multi.restype = ctypes.c_int
+        self.perform_highpass_multi.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.perform_bandpass_multi = self.lib.perform_bandpass_multi
+        self.perform_bandpass_multi.restype = ctypes.c_int
+        self.perform_bandpass_multi.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.perform_bandstop_multi = self.lib.perform_bandstop_multi
+        self.perform_bandstop_multi.restype = ctypes.c_int
+        self.perform_bandstop_multi.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.get_psd_welch_multi = self.lib.get_psd_welch_multi
+        self.get_psd_welch_multi.restype = ctypes.c_int
+        self.get_psd_welch_multi.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_double),
+            ndpointer (ctypes.c_double)
+        ]
+
+        self.create_filter = self.lib.create_filter
+        self.create_filter.restype = ctypes.c_int
+        self.create_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ndpointer (ctypes.c_int32)
+        ]
+
+        self.process_filter = self.lib.process_filter
+        self.process_filter.restype = ctypes.c_int
+        self.process_filter.argtypes = [
+            ctypes.c_int,
+            ndpointer (ctypes.c_double),
+            ctypes.c_int
+        ]
+
+        self.release_filter = self.lib.release_filter
+        self.release_filter.restype = ctypes.c_int
+        self.release_filter.argtypes = [
+            ctypes.c_int
+        ]
+
         self.write_file = self.lib.write_file
         self.write_file.restype = ctypes.c_int
         self.write_file.argtypes = [
@@ -172,6 +287,28 @@ class DataHandlerDLL (object):
             ctypes.c_int
         ]
 
+        self.create_rolling_filter = self.lib.create_rolling_filter
+        self.create_rolling_filter.restype = ctypes.c_int
+        self.create_rolling_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32)
+        ]
+
+        self.process_rolling_filter = self.lib.process_rolling_filter
+        self.process_rolling_filter.restype = ctypes.c_int
+        self.process_rolling_filter.argtypes = [
+            ctypes.c_int,
+            ndpointer (ctypes.c_double),
+            ctypes.c_int
+        ]
+
+        self.release_rolling_filter = self.lib.release_rolling_filter
+        self.release_rolling_filter.restype = ctypes.c_int
+        self.release_rolling_filter.argtypes = [
+            ctypes.c_int
+        ]
+
         self.perform_downsampling = self.lib.perform_downsampling
         self.perform_downsampling.restype = ctypes.c_int
         self.perform_downsampling.argtypes = [
@@ -182,6 +319,25 @@ class DataHandlerDLL (object):
             ndpointer (ctypes.c_double)
         ]
 
+        self.get_resampled_len = self.lib.get_resampled_len
+        self.get_resampled_len.restype = ctypes.c_int
+        self.get_resampled_len.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32)
+        ]
+
+        self.perform_resampling = self.lib.perform_resampling
+        self.perform_resampling.restype = ctypes.c_int
+        self.perform_resampling.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_double)
+        ]
+
         self.perform_wavelet_transform = self.lib.perform_wavelet_transform
         self.perform_wavelet_transform.restype = ctypes.c_int
         self.perform_wavelet_transform.argtypes = [
@@ -214,6 +370,18 @@ class DataHandlerDLL (object):
             ndpointer (ctypes.c_double)
         ]
 
+        self.perform_wavelet_denoising_multi = self.lib.perform_wavelet_denoising_multi
+        self.perform_wavelet_denoising_multi.restype = ctypes.c_int
+        self.perform_wavelet_denoising_multi.argtypes = [
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p,
+            ctypes.c_int
+        ]
+
         self.perform_ifft = self.lib.perform_ifft
         self.perform_ifft.restype = ctypes.c_int
         self.perform_ifft.argtypes = [
@@ -251,6 +419,39 @@ class DataHandlerDLL (object):
             ndpointer (ctypes.c_double),
         ]
 
+        self.create_band_power_tracker = self.lib.create_band_power_tracker
+        self.create_band_power_tracker.restype = ctypes.c_int
+        self.create_band_power_tracker.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer (ctypes.c_int32)
+        ]
+
+        self.add_band_power_tracker_data = self.lib.add_band_power_tracker_data
+        self.add_band_power_tracker_data.restype = ctypes.c_int
+        self.add_band_power_tracker_data.argtypes = [
+            ctypes.c_int,
+            ndpointer (ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.get_band_power_tracker_values = self.lib.get_band_power_tracker_values
+        self.get_band_power_tracker_values.restype = ctypes.c_int
+        self.get_band_power_tracker_values.argtypes = [
+            ctypes.c_int,
+            ndpointer (ctypes.c_double),
+            ndpointer (ctypes.c_double)
+        ]
+
+        self.release_band_power_tracker = self.lib.release_band_power_tracker
+        self.release_band_power_tracker.restype = ctypes.c_int
+        self.release_band_power_tracker.argtypes = [
+            ctypes.c_int
+        ]
+
         self.get_psd = self.lib.get_psd
         self.get_psd.restype = ctypes.c_int
         self.get_psd.argtypes = [
@@ -454,6 +655,200 @@ class DataFilter (object):
         if res != BrainflowExitCodes.STATUS_OK.value:
             raise BrainFlowError ('unable to apply band stop filter', res)
 
+    @classmethod
+    def _get_multi_channels (cls, data: NDArray[Float64], channels: List) -> NDArray:
+        """validate 2d data and convert channels for methods which process several rows in one call"""
+        if len (data.shape) != 2:
+            raise BrainFlowError ('wrong shape for data array, it should be 2d array', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        # data is processed in place, so it can not be copied to make it contiguous
+        if (data.dtype != numpy.float64) or (not data.flags['C_CONTIGUOUS']):
+            raise BrainFlowError ('data should be C contiguous array of float64', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if len (channels) == 0:
+            raise BrainFlowError ('channels list is empty', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        return numpy.array (channels).astype (numpy.int32)
+
+    @classmethod
+    def perform_lowpass_multi (cls, data: NDArray[Float64], channels: List, sampling_rate: int, cutoff: float, order: int, filter_type: int, ripple: float) -> None:
+        """apply low pass filter to several rows of 2d array using single call
+
+        :param data: 2d array from get_board_data, filter works in-place
+        :type data: NDArray[Float64]
+        :param channels: rows of data array to filter
+        :type channels: List
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param cutoff: cutoff frequency
+        :type cutoff: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        if not isinstance (sampling_rate, int):
+            raise BrainFlowError ('wrong type for sampling rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (filter_type, int):
+            raise BrainFlowError ('wrong type for filter type', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        channels_array = cls._get_multi_channels (data, channels)
+        res = DataHandlerDLL.get_instance ().perform_lowpass_multi (data, data.shape[0], data.shape[1], channels_array, channels_array.shape[0],
+            sampling_rate, cutoff, order, filter_type, ripple)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to perform low pass filter', res)
+
+    @classmethod
+    def perform_highpass_multi (cls, data: NDArray[Float64], channels: List, sampling_rate: int, cutoff: float, order: int, filter_type: int, ripple: float) -> None:
+        """apply high pass filter to several rows of 2d array using single call
+
+        :param data: 2d array from get_board_data, filter works in-place
+        :type data: NDArray[Float64]
+        :param channels: rows of data array to filter
+        :type channels: List
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param cutoff: cutoff frequency
+        :type cutoff: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        if not isinstance (sampling_rate, int):
+            raise BrainFlowError ('wrong type for sampling rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (filter_type, int):
+            raise BrainFlowError ('wrong type for filter type', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        channels_array = cls._get_multi_channels (data, channels)
+        res = DataHandlerDLL.get_instance ().perform_highpass_multi (data, data.shape[0], data.shape[1], channels_array, channels_array.shape[0],
+            sampling_rate, cutoff, order, filter_type, ripple)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to apply high pass filter', res)
+
+    @classmethod
+    def perform_bandpass_multi (cls, data: NDArray[Float64], channels: List, sampling_rate: int, center_freq: float,
+        band_width: float, order: int, filter_type: int, ripple: float) -> None:
+        """apply band pass filter to several rows of 2d array using single call
+
+        :param data: 2d array from get_board_data, filter works in-place
+        :type data: NDArray[Float64]
+        :param channels: rows of data array to filter
+        :type channels: List
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param center_freq: center frequency
+        :type center_freq: float
+        :param band_width: band width
+        :type band_width: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        if not isinstance (sampling_rate, int):
+            raise BrainFlowError ('wrong type for sampling rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (filter_type, int):
+            raise BrainFlowError ('wrong type for filter type', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        channels_array = cls._get_multi_channels (data, channels)
+        res = DataHandlerDLL.get_instance ().perform_bandpass_multi (data, data.shape[0], data.shape[1], channels_array, channels_array.shape[0],
+            sampling_rate, center_freq, band_width, order, filter_type, ripple)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to apply band pass filter', res)
+
+    @classmethod
+    def perform_bandstop_multi (cls, data: NDArray[Float64], channels: List, sampling_rate: int, center_freq: float,
+        band_width: float, order: int, filter_type: int, ripple: float) -> None:
+        """apply band stop filter to several rows of 2d array using single call
+
+        :param data: 2d array from get_board_data, filter works in-place
+        :type data: NDArray[Float64]
+        :param channels: rows of data array to filter
+        :type channels: List
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param center_freq: center frequency
+        :type center_freq: float
+        :param band_width: band width
+        :type band_width: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        if not isinstance (sampling_rate, int):
+            raise BrainFlowError ('wrong type for sampling rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (filter_type, int):
+            raise BrainFlowError ('wrong type for filter type', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        channels_array = cls._get_multi_channels (data, channels)
+        res = DataHandlerDLL.get_instance ().perform_bandstop_multi (data, data.shape[0], data.shape[1], channels_array, channels_array.shape[0],
+            sampling_rate, center_freq, band_width, order, filter_type, ripple)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to apply band stop filter', res)
+
+    @classmethod
+    def create_filter (cls, filter_operation: int, sampling_rate: int, freq: float, band_width: float, order: int, filter_type: int, ripple: float) -> int:
+        """create filter which keeps its state between process_filter calls, use it to filter data chunk by chunk
+
+        :param filter_operation: filter operation from special enum
+        :type filter_operation: int
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param freq: cutoff frequency for low and high pass filters, center frequency for band pass and band stop filters
+        :type freq: float
+        :param band_width: band width, ignored for low and high pass filters
+        :type band_width: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        :return: filter id
+        :rtype: int
+        """
+        if not isinstance (filter_operation, int):
+            raise BrainFlowError ('wrong type for filter operation', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (sampling_rate, int):
+            raise BrainFlowError ('wrong type for sampling rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (filter_type, int):
+            raise BrainFlowError ('wrong type for filter type', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        filter_id = numpy.zeros (1).astype (numpy.int32)
+        res = DataHandlerDLL.get_instance ().create_filter (filter_operation, sampling_rate, freq, band_width, order, filter_type, ripple, filter_id)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to create filter', res)
+
+        return int (filter_id[0])
+
+    @classmethod
+    def process_filter (cls, filter_id: int, data: NDArray[Float64]) -> None:
+        """filter next chunk of data using filter created by create_filter
+
+        :param filter_id: filter id
+        :type filter_id: int
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Float64]
+        """
+        if len (data.shape) != 1:
+            raise BrainFlowError ('wrong shape for filter data array, it should be 1d array', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        res = DataHandlerDLL.get_instance ().process_filter (filter_id, data, data.shape[0])
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to filter data', res)
+
+    @classmethod
+    def release_filter (cls, filter_id: int) -> None:
+        """release filter created by create_filter
+
+        :param filter_id: filter id
+        :type filter_id: int
+        """
+        res = DataHandlerDLL.get_instance ().release_filter (filter_id)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to release filter', res)
+
     @classmethod
     def perform_rolling_filter (cls, data: NDArray[Float64], period: int, operation: int) -> None:
         """smooth data using moving average or median
@@ -475,9 +870,57 @@ class DataFilter (object):
         if res != BrainflowExitCodes.STATUS_OK.value:
             raise BrainFlowError ('unable to smooth data', res)
 
+    @classmethod
+    def create_rolling_filter (cls, period: int, operation: int) -> int:
+        """create moving average or median filter which keeps its window between process_rolling_filter calls
+
+        :param period: window size
+        :type period: int
+        :param operation: int value from AggOperation enum, only mean and median are supported
+        :type operation: int
+        :return: filter id
+        :rtype: int
+        """
+        if not isinstance (period, int):
+            raise BrainFlowError ('wrong type for period', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (operation, int):
+            raise BrainFlowError ('wrong type for operation', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        filter_id = numpy.zeros (1).astype (numpy.int32)
+        res = DataHandlerDLL.get_instance ().create_rolling_filter (period, operation, filter_id)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to create rolling filter', res)
+
+        return int (filter_id[0])
+
+    @classmethod
+    def process_rolling_filter (cls, filter_id: int, data: NDArray[Float64]) -> None:
+        """smooth next chunk of data using filter created by create_rolling_filter
+
+        :param filter_id: filter id
+        :type filter_id: int
+        :param data: data to smooth, it works in-place
+        :type data: NDArray[Float64]
+        """
+        if len (data.shape) != 1:
+            raise BrainFlowError ('wrong shape for filter data array, it should be 1d array', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        res = DataHandlerDLL.get_instance ().process_rolling_filter (filter_id, data, data.shape[0])
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to smooth data', res)
+
+    @classmethod
+    def release_rolling_filter (cls, filter_id: int) -> None:
+        """release filter created by create_rolling_filter
+
+        :param filter_id: filter id
+        :type filter_id: int
+        """
+        res = DataHandlerDLL.get_instance ().release_rolling_filter (filter_id)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to release rolling filter', res)
+
     @classmethod
     def perform_downsampling (cls, data: NDArray[Float64], period: int, operation: int) -> NDArray[Float64]:
-        """perform data downsampling, it doesnt apply lowpass filter for you, it just aggregates several data points
+        """perform data downsampling, it doesnt apply lowpass filter for you, it just aggregates several data points, except FIR_DECIMATION which filters data before decimation
 
         :param data: initial data
         :type data: NDArray[Float64]
@@ -504,6 +947,52 @@ class DataFilter (object):
 
         return downsampled_data
 
+    @classmethod
+    def get_resampled_len (cls, data_len: int, input_rate: int, output_rate: int) -> int:
+        """get number of output samples for perform_resampling
+
+        :param data_len: number of input samples
+        :type data_len: int
+        :param input_rate: sampling rate of input data
+        :type input_rate: int
+        :param output_rate: required sampling rate
+        :type output_rate: int
+        :return: number of output samples
+        :rtype: int
+        """
+        output_len = numpy.zeros (1).astype (numpy.int32)
+        res = DataHandlerDLL.get_instance ().get_resampled_len (data_len, input_rate, output_rate, output_len)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to calc resampled len', res)
+        return int (output_len[0])
+
+    @classmethod
+    def perform_resampling (cls, data: NDArray[Float64], input_rate: int, output_rate: int) -> NDArray[Float64]:
+        """convert data to another sampling rate using polyphase filter
+
+        :param data: initial data
+        :type data: NDArray[Float64]
+        :param input_rate: sampling rate of input data
+        :type input_rate: int
+        :param output_rate: required sampling rate
+        :type output_rate: int
+        :return: resampled data
+        :rtype: NDArray[Float64]
+        """
+        if not isinstance (input_rate, int):
+            raise BrainFlowError ('wrong type for input_rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (output_rate, int):
+            raise BrainFlowError ('wrong type for output_rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if len (data.shape) != 1:
+            raise BrainFlowError ('wrong shape for filter data array, it should be 1d array', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+
+        resampled_data = numpy.zeros (cls.get_resampled_len (data.shape[0], input_rate, output_rate)).astype (numpy.float64)
+        res = DataHandlerDLL.get_instance ().perform_resampling (data, data.shape[0], input_rate, output_rate, resampled_data)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to perform resampling', res)
+
+        return resampled_data
+
     @classmethod
     def perform_wavelet_transform (cls, data: NDArray[Float64], wavelet: str, decomposition_level: int) -> Tuple:
         """perform wavelet transform
@@ -578,6 +1067,30 @@ class DataFilter (object):
         if res != BrainflowExitCodes.STATUS_OK.value:
             raise BrainFlowError ('unable to denoise data', res)
 
+    @classmethod
+    def perform_wavelet_denoising_multi (cls, data: NDArray[Float64], channels: List, wavelet: str, decomposition_level: int) -> None:
+        """perform wavelet denoising for several rows of 2d array using single call, rows are processed in parallel
+
+        :param data: 2d array from get_board_data, denoising works in-place
+        :type data: NDArray[Float64]
+        :param channels: rows of data array to denoise
+        :type channels: List
+        :param wavelet: supported vals: db1..db15,haar,sym2..sym10,coif1..coif5,bior1.1,bior1.3,bior1.5,bior2.2,bior2.4,bior2.6,bior2.8,bior3.1,bior3.3,bior3.5 ,bior3.7,bior3.9,bior4.4,bior5.5,bior6.8
+        :type wavelet: str
+        :param decomposition_level: decomposition level
+        :type decomposition_level: int
+        """
+        try:
+            wavelet_func = wavelet.encode ()
+        except:
+            wavelet_func = wavelet
+
+        channels_array = cls._get_multi_channels (data, channels)
+        res = DataHandlerDLL.get_instance ().perform_wavelet_denoising_multi (data, data.shape[0], data.shape[1], channels_array, channels_array.shape[0],
+            wavelet_func, decomposition_level)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to denoise data', res)
+
     @classmethod
     def perform_fft (cls, data: NDArray[Float64], window: int) -> NDArray[Complex128]:
         """perform direct fft
@@ -665,6 +1178,41 @@ class DataFilter (object):
 
         return ampls, freqs
 
+    @classmethod
+    def get_psd_welch_multi (cls, data: NDArray[Float64], channels: List, nfft: int, overlap: int, sampling_rate: int, window: int) -> Tuple:
+        """calculate PSD using Welch method for several rows of 2d array using single call
+
+        :param data: 2d array from get_board_data
+        :type data: NDArray[Float64]
+        :param channels: rows of data array to calc psd
+        :type channels: List
+        :param nfft: FFT Window size, must be power of 2
+        :type nfft: int
+        :param overlap: overlap of FFT Windows, must be between 0 and nfft
+        :type overlap: int
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param window: window function
+        :type window: int
+        :return: 2d amplitude array with row of len N / 2 + 1 for each channel and frequency array of len N / 2 + 1
+        :rtype: tuple
+        """
+        def is_power_of_two (n):
+            return (n != 0) and (n & (n - 1) == 0)
+
+        if (not is_power_of_two (nfft)):
+            raise BrainFlowError ('nfft is not power of 2: %d' % nfft, BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        channels_array = cls._get_multi_channels (data, channels)
+
+        ampls = numpy.zeros ((channels_array.shape[0], int (nfft / 2 + 1))).astype (numpy.float64)
+        freqs = numpy.zeros (int (nfft / 2 + 1)).astype (numpy.float64)
+        res = DataHandlerDLL.get_instance ().get_psd_welch_multi (data, data.shape[0], data.shape[1], channels_array, channels_array.shape[0],
+            nfft, overlap, sampling_rate, window, ampls, freqs)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to calc psd welch', res)
+
+        return ampls, freqs
+
     @classmethod
     def detrend (cls, data: NDArray[Float64], detrend_operation: int) -> None:
         """detrend data
@@ -732,6 +1280,80 @@ class DataFilter (object):
 
         return avg_bands, stddev_bands
 
+    @classmethod
+    def create_band_power_tracker (cls, num_channels: int, sampling_rate: int, window_size: int, apply_filter: bool) -> int:
+        """create tracker which calculates the same values as get_avg_band_powers for the latest window but processes each new datapoint only once
+
+        :param num_channels: number of channels which will be added to tracker
+        :type num_channels: int
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param window_size: number of datapoints in window
+        :type window_size: int
+        :param apply_filter: apply bandpass and bandstop filtrers or not
+        :type apply_filter: bool
+        :return: tracker id
+        :rtype: int
+        """
+        if not isinstance (sampling_rate, int):
+            raise BrainFlowError ('wrong type for sampling rate', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance (window_size, int):
+            raise BrainFlowError ('wrong type for window size', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        tracker_id = numpy.zeros (1).astype (numpy.int32)
+        res = DataHandlerDLL.get_instance ().create_band_power_tracker (num_channels, sampling_rate, window_size,
+            int (apply_filter), tracker_id)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to create band power tracker', res)
+
+        return int (tracker_id[0])
+
+    @classmethod
+    def add_band_power_tracker_data (cls, tracker_id: int, data: NDArray, channels: List) -> None:
+        """add new datapoints to tracker
+
+        :param tracker_id: tracker id
+        :type tracker_id: int
+        :param data: 2d array with new datapoints
+        :type data: NDArray
+        :param channels: rows of data array which should be used, number of channels must be the same as in create_band_power_tracker
+        :type channels: List
+        """
+        if (data.ndim != 2):
+            raise BrainFlowError ('Shape of data array must be 2', BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+
+        data_1d = numpy.ascontiguousarray (data[list (channels)], dtype = numpy.float64)
+        res = DataHandlerDLL.get_instance ().add_band_power_tracker_data (tracker_id, data_1d, data_1d.shape[0], data_1d.shape[1])
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to add data to band power tracker', res)
+
+    @classmethod
+    def get_band_power_tracker_values (cls, tracker_id: int) -> Tuple:
+        """get avg and stddev of BandPowers for the latest window
+
+        :param tracker_id: tracker id
+        :type tracker_id: int
+        :return: avg and stddev arrays for bandpowers
+        :rtype: tuple
+        """
+        avg_bands = numpy.zeros (5).astype (numpy.float64)
+        stddev_bands = numpy.zeros (5).astype (numpy.float64)
+        res = DataHandlerDLL.get_instance ().get_band_power_tracker_values (tracker_id, avg_bands, stddev_bands)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to get band powers from tracker', res)
+
+        return avg_bands, stddev_bands
+
+    @classmethod
+    def release_band_power_tracker (cls, tracker_id: int) -> None:
+        """release tracker created by create_band_power_tracker
+
+        :param tracker_id: tracker id
+        :type tracker_id: int
+        """
+        res = DataHandlerDLL.get_instance ().release_band_power_tracker (tracker_id)
+        if res != BrainflowExitCodes.STATUS_OK.value:
+            raise BrainFlowError ('unable to release band power tracker', res)
+
     @classmethod
     def perform_ifft (cls, data: NDArray[Complex128]) -> NDArray[Float64]:
         """perform inverse fft
@@ -1,7 +1,9 @@
 #include <string>
+#include <vector>
 
 #include "board.h"
 #include "board_controller.h"
+#include "composite_streamer.h"
 #include "file_streamer.h"
 #include "multicast_streamer.h"
 #include "stub_streamer.h"
@@ -82,52 +84,39 @@ int Board::prepare_streamer (char *streamer_params)
     }
     else
     {
-        // parse string, sscanf doesnt work
+        // several streamers are separated by ';', e.g. file://data.csv:w;streaming_board://...
+        std::vector<Streamer *> streamers;
         std::string streamer_params_str (streamer_params);
-        size_t idx1 = streamer_params_str.find ("://");
-        if (idx1 == std::string::npos)
+        size_t start = 0;
+        while (start <= streamer_params_str.size ())
         {
-            safe_logger (
-                spdlog::level::err, "format is streamer_type://streamer_dest:streamer_args");
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-        }
-        std::string streamer_type = streamer_params_str.substr (0, idx1);
-        size_t idx2 = streamer_params_str.find_last_of (":", std::string::npos);
-        if ((idx2 == std::string::npos) || (idx1 == idx2))
-        {
-            safe_logger (
-                spdlog::level::err, "format is streamer_type://streamer_dest:streamer_args");
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-        }
-        std::string streamer_dest = streamer_params_str.substr (idx1 + 3, idx2 - idx1 - 3);
-        std::string streamer_mods = streamer_params_str.substr (idx2 + 1);
-
-        if (streamer_type == "file")
-        {
-            safe_logger (spdlog::level::trace, "File Streamer, file: {}, mods: {}",
-                streamer_dest.c_str (), streamer_mods.c_str ());
-            streamer = new FileStreamer (streamer_dest.c_str (), streamer_mods.c_str ());
-        }
-        if (streamer_type == "streaming_board")
-        {
-            int port = 0;
-            try
+            size_t end = streamer_params_str.find (";", start);
+            if (end == std::string::npos)
             {
-                port = std::stoi (streamer_mods);
+                end = streamer_params_str.size ();
             }
-            catch (const std::exception &e)
+            Streamer *new_streamer = NULL;
+            int res =
+                create_streamer (streamer_params_str.substr (start, end - start), &new_streamer);
+            if (res != (int)BrainFlowExitCodes::STATUS_OK)
             {
-                safe_logger (spdlog::level::err, e.what ());
-                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+                for (size_t i = 0; i < streamers.size (); i++)
+                {
+                    delete streamers[i];
+                }
+                return res;
             }
-            streamer = new MultiCastStreamer (streamer_dest.c_str (), port);
+            streamers.push_back (new_streamer);
+            start = end + 1;
         }
-
-        if (streamer == NULL)
+        if (streamers.size () == 1)
         {
-            safe_logger (
-                spdlog::level::err, "unsupported streamer type {}", streamer_type.c_str ());
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            streamer = streamers[0];
+        }
+        else
+        {
+            safe_logger (spdlog::level::debug, "use {} streamers", streamers.size ());
+            streamer = new CompositeStreamer (streamers);
         }
     }
 
@@ -142,26 +131,107 @@ int Board::prepare_streamer (char *streamer_params)
     return res;
 }
 
-int Board::get_current_board_data (int num_samples, double *data_buf, int *returned_samples)
+int Board::create_streamer (std::string streamer_params_str, Streamer **new_streamer)
 {
-    if (db && data_buf && returned_samples)
+    // parse string, sscanf doesnt work
+    size_t idx1 = streamer_params_str.find ("://");
+    if (idx1 == std::string::npos)
+    {
+        safe_logger (spdlog::level::err, "format is streamer_type://streamer_dest:streamer_args");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::string streamer_type = streamer_params_str.substr (0, idx1);
+    size_t idx2 = streamer_params_str.find_last_of (":", std::string::npos);
+    if ((idx2 == std::string::npos) || (idx1 == idx2))
+    {
+        safe_logger (spdlog::level::err, "format is streamer_type://streamer_dest:streamer_args");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::string streamer_dest = streamer_params_str.substr (idx1 + 3, idx2 - idx1 - 3);
+    std::string streamer_mods = streamer_params_str.substr (idx2 + 1);
+
+    if (streamer_type == "file")
+    {
+        safe_logger (spdlog::level::trace, "File Streamer, file: {}, mods: {}",
+            streamer_dest.c_str (), streamer_mods.c_str ());
+        *new_streamer = new FileStreamer (streamer_dest.c_str (), streamer_mods.c_str (), board_id);
+    }
+    if (streamer_type == "streaming_board")
     {
-        int num_data_channels = -1;
-        int res = get_num_rows (board_id, &num_data_channels);
-        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        // optional batch size: streaming_board://ip:port:batch_size
+        std::string port_str = streamer_mods;
+        std::string batch_size_str = "1";
+        size_t idx3 = streamer_dest.find (":");
+        if (idx3 != std::string::npos)
         {
-            return res;
+            port_str = streamer_dest.substr (idx3 + 1);
+            batch_size_str = streamer_mods;
+            streamer_dest = streamer_dest.substr (0, idx3);
         }
-        num_data_channels--; // columns_size includes timestamp channel, which is a separated field
-                             // in DataBuffer class
-
-        double *buf = new double[num_samples * num_data_channels];
-        double *ts_buf = new double[num_samples];
-        int num_data_points = (int)db->get_current_data (num_samples, ts_buf, buf);
-        reshape_data (num_data_points, buf, ts_buf, data_buf);
-        delete[] buf;
-        delete[] ts_buf;
-        *returned_samples = num_data_points;
+        int port = 0;
+        int batch_size = 1;
+        try
+        {
+            port = std::stoi (port_str);
+            batch_size = std::stoi (batch_size_str);
+        }
+        catch (const std::exception &e)
+        {
+            safe_logger (spdlog::level::err, e.what ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        *new_streamer = new MultiCastStreamer (streamer_dest.c_str (), port, batch_size);
+    }
+
+    if (*new_streamer == NULL)
+    {
+        safe_logger (spdlog::level::err, "unsupported streamer type {}", streamer_type.c_str ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::set_buffer_layout (int layout)
+{
+    if ((layout != (int)BufferLayouts::INTERLEAVED) && (layout != (int)BufferLayouts::BY_CHANNELS))
+    {
+        safe_logger (spdlog::level::err, "unsupported buffer layout {}", layout);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    buffer_layout = static_cast<BufferLayouts> (layout);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void Board::start_stats ()
+{
+    int package_num_channel = -1;
+    if (get_package_num_channel (board_id, &package_num_channel) !=
+        (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        package_num_channel = -1;
+    }
+    stats.restart (package_num_channel, samples_per_package_num);
+}
+
+int Board::get_board_stats (std::string &board_stats)
+{
+    try
+    {
+        board_stats = stats.to_json ();
+    }
+    catch (...)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::get_current_board_data (int num_samples, double *data_buf, int *returned_samples)
+{
+    if (db && data_buf && returned_samples)
+    {
+        // DataBuffer writes data directly to data_buf with timestamps in the last row
+        *returned_samples = (int)db->get_current_data (num_samples, data_buf);
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
     else
@@ -195,41 +265,55 @@ int Board::get_board_data (int data_count, double *data_buf)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    int num_data_channels = 0;
-    int res = get_num_rows (board_id, &num_data_channels);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    db->get_data (data_count, data_buf);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::create_reader (int *reader_id)
+{
+    if (!db)
     {
-        return res;
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-    num_data_channels--; // columns_size includes timestamp channel, which is a separated field
-                         // in DataBuffer class
-
-    double *buf = new double[data_count * num_data_channels];
-    double *ts_buf = new double[data_count];
-    int num_data_points = (int)db->get_data (data_count, ts_buf, buf);
-    reshape_data (num_data_points, buf, ts_buf, data_buf);
-    delete[] buf;
-    delete[] ts_buf;
+    if (!reader_id)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    *reader_id = db->create_reader ();
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void Board::reshape_data (
-    int data_count, const double *buf, const double *ts_buf, double *output_buf)
+int Board::release_reader (int reader_id)
 {
-    int num_data_channels = 0;
-    get_num_rows (board_id, &num_data_channels); // here we know that board id is valid
-    num_data_channels--;                         // -1 because of timestamp
+    if (!db)
+    {
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    if (!db->release_reader (reader_id))
+    {
+        safe_logger (spdlog::level::err, "reader {} doesnt exist", reader_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    for (int i = 0; i < data_count; i++)
+int Board::read_new_samples (
+    int reader_id, int max_samples, double *data_buf, int *returned_samples)
+{
+    if (!db)
     {
-        for (int j = 0; j < num_data_channels; j++)
-        {
-            output_buf[j * data_count + i] = buf[i * num_data_channels + j];
-        }
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-    // add timestamp to resulting data table
-    for (int i = 0; i < data_count; i++)
+    if ((!data_buf) || (!returned_samples) || (max_samples < 0))
     {
-        output_buf[num_data_channels * data_count + i] = ts_buf[i];
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    size_t result_count = 0;
+    if (!db->get_new_data (reader_id, (size_t)max_samples, data_buf, &result_count))
+    {
+        safe_logger (spdlog::level::err, "reader {} doesnt exist", reader_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    *returned_samples = (int)result_count;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
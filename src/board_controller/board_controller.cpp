@@ -34,6 +34,7 @@
 #include "ironbci.h"
 #include "notion_osc.h"
 #include "playback_file_board.h"
+#include "shared_mutex.h"
 #include "streaming_board.h"
 #include "synthetic_board.h"
 #include "unicorn_board.h"
@@ -43,21 +44,31 @@
 using json = nlohmann::json;
 
 
-std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<Board>> boards;
-std::mutex mutex;
+// operations on the same board are serialized by its own mutex, boards map is locked only to find
+// or add/remove session, so slow calls like prepare_session dont block other boards
+struct BoardSession
+{
+    std::pair<int, struct BrainFlowInputParams> key;
+    std::shared_ptr<Board> board; // NULL while session is being prepared or after release
+    std::mutex mutex;
+};
+
+std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<BoardSession>> boards;
+SharedMutex boards_mutex;
+std::mutex log_mutex;
 
 std::pair<int, struct BrainFlowInputParams> get_key (
     int board_id, struct BrainFlowInputParams params);
-static int check_board_session (int board_id, char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error = true);
+static int lock_board_session (int board_id, char *json_brainflow_input_params,
+    std::shared_ptr<BoardSession> &session, std::unique_lock<std::mutex> &lock,
+    bool log_error = false);
+static void remove_board_session (std::shared_ptr<BoardSession> session);
 static int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params);
 
 
 int prepare_session (int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
     Board::board_logger->info ("incoming json: {}", json_brainflow_input_params);
     struct BrainFlowInputParams params;
     int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
@@ -66,12 +77,20 @@ int prepare_session (int board_id, char *json_brainflow_input_params)
         return res;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key = get_key (board_id, params);
-    if (boards.find (key) != boards.end ())
+    // add session before preparing the board to reserve the key, other calls for this board wait
+    // until prepare_session is finished
+    std::shared_ptr<BoardSession> session (new BoardSession ());
+    session->key = get_key (board_id, params);
+    std::unique_lock<std::mutex> session_lock (session->mutex);
     {
-        Board::board_logger->error (
-            "Board with id {} and the same config already exists", board_id);
-        return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
+        std::lock_guard<SharedMutex> lock (boards_mutex);
+        if (boards.find (session->key) != boards.end ())
+        {
+            Board::board_logger->error (
+                "Board with id {} and the same config already exists", board_id);
+            return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
+        }
+        boards[session->key] = session;
     }
 
     std::shared_ptr<Board> board = NULL;
@@ -139,26 +158,29 @@ int prepare_session (int board_id, char *json_brainflow_input_params)
             board = std::shared_ptr<Board> (new FreeEEG32 (params));
             break;
         default:
+            session_lock.unlock ();
+            remove_board_session (session);
             return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
     res = board->prepare_session ();
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         board = NULL;
+        session_lock.unlock ();
+        remove_board_session (session);
     }
     else
     {
-        boards[key] = board;
+        session->board = board;
     }
     return res;
 }
 
 int is_prepared (int *prepared, int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         *prepared = 1;
@@ -174,95 +196,136 @@ int is_prepared (int *prepared, int board_id, char *json_brainflow_input_params)
 int start_stream (
     int buffer_size, char *streamer_params, int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    session->board->start_stats ();
+    return session->board->start_stream (buffer_size, streamer_params);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int set_buffer_layout (int layout, int board_id, char *json_brainflow_input_params)
+{
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->start_stream (buffer_size, streamer_params);
+    return session->board->set_buffer_layout (layout);
 }
 
 int stop_stream (int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->stop_stream ();
+    return session->board->stop_stream ();
 }
 
 int release_session (int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    res = board_it->second->release_session ();
-    boards.erase (board_it);
+    res = session->board->release_session ();
+    // threads which already found this session will see that board is released
+    session->board = NULL;
+    lock.unlock ();
+    remove_board_session (session);
     return res;
 }
 
 int get_current_board_data (int num_samples, double *data_buf, int *returned_samples, int board_id,
     char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_current_board_data (num_samples, data_buf, returned_samples);
+    return session->board->get_current_board_data (num_samples, data_buf, returned_samples);
 }
 
 int get_board_data_count (int *result, int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data_count (result);
+    return session->board->get_board_data_count (result);
 }
 
 int get_board_data (
     int data_count, double *data_buf, int board_id, char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return session->board->get_board_data (data_count, data_buf);
+}
+
+int create_reader (int *reader_id, int board_id, char *json_brainflow_input_params)
+{
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return session->board->create_reader (reader_id);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int read_new_samples (int reader_id, int max_samples, double *data_buf, int *returned_samples,
+    int board_id, char *json_brainflow_input_params)
+{
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data (data_count, data_buf);
+    return session->board->read_new_samples (reader_id, max_samples, data_buf, returned_samples);
+}
+
+int release_reader (int reader_id, int board_id, char *json_brainflow_input_params)
+{
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return session->board->release_reader (reader_id);
 }
 
 int set_log_level (int log_level)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::lock_guard<std::mutex> lock (log_mutex);
     return Board::set_log_level (log_level);
 }
 
@@ -270,7 +333,7 @@ int log_message (int log_level, char *log_message)
 {
     // its a method for loggging from high level api dont add it to Board class since it should not
     // be used internally
-    std::lock_guard<std::mutex> lock (mutex);
+    std::lock_guard<std::mutex> lock (log_mutex);
     int level;
     if (log_level < 0)
     {
@@ -294,29 +357,28 @@ int log_message (int log_level, char *log_message)
 
 int set_log_file (char *log_file)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::lock_guard<std::mutex> lock (log_mutex);
     return Board::set_log_file (log_file);
 }
 
 int config_board (char *config, char *response, int *response_len, int board_id,
     char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if ((config == NULL) || (response == NULL) || (response_len == NULL))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
     std::string conf = config;
     std::string resp = "";
-    res = board_it->second->config_board (conf, resp);
+    res = session->board->config_board (conf, resp);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         *response_len = resp.length ();
@@ -325,6 +387,31 @@ int config_board (char *config, char *response, int *response_len, int board_id,
     return res;
 }
 
+int get_board_stats (
+    char *board_stats, int *board_stats_len, int board_id, char *json_brainflow_input_params)
+{
+    if ((board_stats == NULL) || (board_stats_len == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    std::shared_ptr<BoardSession> session;
+    std::unique_lock<std::mutex> lock;
+    int res = lock_board_session (board_id, json_brainflow_input_params, session, lock);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    std::string stats = "";
+    res = session->board->get_board_stats (stats);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        *board_stats_len = stats.length ();
+        strcpy (board_stats, stats.c_str ());
+    }
+    return res;
+}
+
 /////////////////////////////////////////////////
 //////////////////// helpers ////////////////////
 /////////////////////////////////////////////////
@@ -336,8 +423,8 @@ std::pair<int, struct BrainFlowInputParams> get_key (
     return key;
 }
 
-int check_board_session (int board_id, char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error)
+int lock_board_session (int board_id, char *json_brainflow_input_params,
+    std::shared_ptr<BoardSession> &session, std::unique_lock<std::mutex> &lock, bool log_error)
 {
     struct BrainFlowInputParams params;
     int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
@@ -346,18 +433,41 @@ int check_board_session (int board_id, char *json_brainflow_input_params,
         return res;
     }
 
-    key = get_key (board_id, params);
-
-    if (boards.find (key) == boards.end ())
+    std::pair<int, struct BrainFlowInputParams> key = get_key (board_id, params);
     {
-        if (log_error)
+        SharedLockGuard boards_lock (boards_mutex);
+        auto session_it = boards.find (key);
+        if (session_it != boards.end ())
         {
-            Board::board_logger->error (
-                "Board with id {} and port provided config is not created", key.first);
+            session = session_it->second;
         }
-        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    if (session)
+    {
+        lock = std::unique_lock<std::mutex> (session->mutex);
+        // session could be released or failed to prepare while we were waiting for the lock
+        if (session->board)
+        {
+            return (int)BrainFlowExitCodes::STATUS_OK;
+        }
+        lock.unlock ();
+    }
+    if (log_error)
+    {
+        Board::board_logger->error (
+            "Board with id {} and port provided config is not created", key.first);
+    }
+    return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+}
+
+void remove_board_session (std::shared_ptr<BoardSession> session)
+{
+    std::lock_guard<SharedMutex> lock (boards_mutex);
+    auto session_it = boards.find (session->key);
+    if ((session_it != boards.end ()) && (session_it->second == session))
+    {
+        boards.erase (session_it);
+    }
 }
 
 int string_to_brainflow_input_params (
@@ -1,8 +1,8 @@
-#include <fstream>
+#include <algorithm>
 #include <set>
-#include <sstream>
 #include <string.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "board.h"
@@ -10,201 +10,337 @@
 #include "brainflow_boards.h"
 #include "brainflow_constants.h"
 
-inline std::string int_to_string (int val);
-inline int get_single_value (
-    int board_id, const char *param_name, int *value, bool use_logger = true);
-inline int get_string_value (
-    int board_id, const char *param_name, char *string, int *len, bool use_logger = true);
+// json with board descriptions is parsed only once to the table of BoardDescriptor structs, after
+// that all lookups are just array accesses without string conversions and json tree walks
+
+enum class SingleValues : int
+{
+    SAMPLING_RATE = 0,
+    PACKAGE_NUM_CHANNEL = 1,
+    BATTERY_CHANNEL = 2,
+    NUM_ROWS = 3,
+    TIMESTAMP_CHANNEL = 4,
+    NUM_VALUES = 5
+};
+
+enum class ArrayValues : int
+{
+    EEG_CHANNELS = 0,
+    EMG_CHANNELS = 1,
+    ECG_CHANNELS = 2,
+    EOG_CHANNELS = 3,
+    EDA_CHANNELS = 4,
+    PPG_CHANNELS = 5,
+    ACCEL_CHANNELS = 6,
+    ANALOG_CHANNELS = 7,
+    GYRO_CHANNELS = 8,
+    OTHER_CHANNELS = 9,
+    TEMPERATURE_CHANNELS = 10,
+    RESISTANCE_CHANNELS = 11,
+    EXG_CHANNELS = 12, // not in json, sorted union of eeg, emg, ecg and eog channels
+    NUM_VALUES = 13
+};
+
+static const char *single_value_names[(int)SingleValues::NUM_VALUES] = {"sampling_rate",
+    "package_num_channel", "battery_channel", "num_rows", "timestamp_channel"};
+static const char *array_value_names[(int)ArrayValues::NUM_VALUES] = {"eeg_channels",
+    "emg_channels", "ecg_channels", "eog_channels", "eda_channels", "ppg_channels",
+    "accel_channels", "analog_channels", "gyro_channels", "other_channels",
+    "temperature_channels", "resistance_channels", "exg_channels"};
+
+struct BoardDescriptor
+{
+    bool is_valid;
+    bool has_single_value[(int)SingleValues::NUM_VALUES];
+    int single_values[(int)SingleValues::NUM_VALUES];
+    bool has_array_value[(int)ArrayValues::NUM_VALUES];
+    std::vector<int> array_values[(int)ArrayValues::NUM_VALUES];
+    bool has_eeg_names;
+    std::string eeg_names;
+
+    BoardDescriptor ()
+    {
+        is_valid = false;
+        has_eeg_names = false;
+        for (int i = 0; i < (int)SingleValues::NUM_VALUES; i++)
+        {
+            has_single_value[i] = false;
+            single_values[i] = 0;
+        }
+        for (int i = 0; i < (int)ArrayValues::NUM_VALUES; i++)
+        {
+            has_array_value[i] = false;
+        }
+    }
+};
+
+// table of descriptors indexed by board_id - min_board_id
+class BoardDescriptors
+{
+public:
+    BoardDescriptors ();
+
+    // returns NULL for unknown board id
+    const BoardDescriptor *get (int board_id) const
+    {
+        if ((board_id < min_board_id) || (board_id - min_board_id >= (int)descriptors.size ()) ||
+            (!descriptors[board_id - min_board_id].is_valid))
+        {
+            return NULL;
+        }
+        return &descriptors[board_id - min_board_id];
+    }
+
+private:
+    int min_board_id;
+    std::vector<BoardDescriptor> descriptors;
+};
+
+// initialization of function level static is thread safe since c++11
+static const BoardDescriptors &get_board_descriptors ()
+{
+    static BoardDescriptors board_descriptors;
+    return board_descriptors;
+}
+
+inline const BoardDescriptor *get_board_descriptor (int board_id, bool use_logger);
+inline int get_single_value (int board_id, SingleValues param, int *value, bool use_logger = true);
+inline int get_string_value (int board_id, char *string, int *len, bool use_logger = true);
 inline int get_array_value (
-    int board_id, const char *param_name, int *output_array, int *len, bool use_logger = true);
+    int board_id, ArrayValues param, int *output_array, int *len, bool use_logger = true);
+
 
 
 int get_sampling_rate (int board_id, int *sampling_rate)
 {
-    return get_single_value (board_id, "sampling_rate", sampling_rate);
+    return get_single_value (board_id, SingleValues::SAMPLING_RATE, sampling_rate);
 }
 
 int get_package_num_channel (int board_id, int *package_num_channel)
 {
-    return get_single_value (board_id, "package_num_channel", package_num_channel);
+    return get_single_value (board_id, SingleValues::PACKAGE_NUM_CHANNEL, package_num_channel);
 }
 
 int get_battery_channel (int board_id, int *battery_channel)
 {
-    return get_single_value (board_id, "battery_channel", battery_channel);
+    return get_single_value (board_id, SingleValues::BATTERY_CHANNEL, battery_channel);
 }
 
 int get_num_rows (int board_id, int *num_rows)
 {
-    return get_single_value (board_id, "num_rows", num_rows);
+    return get_single_value (board_id, SingleValues::NUM_ROWS, num_rows);
 }
 
 int get_timestamp_channel (int board_id, int *timestamp_channel)
 {
-    return get_single_value (board_id, "timestamp_channel", timestamp_channel);
+    return get_single_value (board_id, SingleValues::TIMESTAMP_CHANNEL, timestamp_channel);
 }
 
 int get_eeg_names (int board_id, char *eeg_names, int *len)
 {
-    return get_string_value (board_id, "eeg_names", eeg_names, len);
+    return get_string_value (board_id, eeg_names, len);
 }
 
 int get_eeg_channels (int board_id, int *eeg_channels, int *len)
 {
-    return get_array_value (board_id, "eeg_channels", eeg_channels, len);
+    return get_array_value (board_id, ArrayValues::EEG_CHANNELS, eeg_channels, len);
 }
 
 int get_emg_channels (int board_id, int *emg_channels, int *len)
 {
-    return get_array_value (board_id, "emg_channels", emg_channels, len);
+    return get_array_value (board_id, ArrayValues::EMG_CHANNELS, emg_channels, len);
 }
 
 int get_ecg_channels (int board_id, int *ecg_channels, int *len)
 {
-    return get_array_value (board_id, "ecg_channels", ecg_channels, len);
+    return get_array_value (board_id, ArrayValues::ECG_CHANNELS, ecg_channels, len);
 }
 
 int get_eog_channels (int board_id, int *eog_channels, int *len)
 {
-    return get_array_value (board_id, "eog_channels", eog_channels, len);
+    return get_array_value (board_id, ArrayValues::EOG_CHANNELS, eog_channels, len);
 }
 
 int get_eda_channels (int board_id, int *eda_channels, int *len)
 {
-    return get_array_value (board_id, "eda_channels", eda_channels, len);
+    return get_array_value (board_id, ArrayValues::EDA_CHANNELS, eda_channels, len);
 }
 
 int get_ppg_channels (int board_id, int *ppg_channels, int *len)
 {
-    return get_array_value (board_id, "ppg_channels", ppg_channels, len);
+    return get_array_value (board_id, ArrayValues::PPG_CHANNELS, ppg_channels, len);
 }
 
 int get_accel_channels (int board_id, int *accel_channels, int *len)
 {
-    return get_array_value (board_id, "accel_channels", accel_channels, len);
+    return get_array_value (board_id, ArrayValues::ACCEL_CHANNELS, accel_channels, len);
 }
 
 int get_analog_channels (int board_id, int *analog_channels, int *len)
 {
-    return get_array_value (board_id, "analog_channels", analog_channels, len);
+    return get_array_value (board_id, ArrayValues::ANALOG_CHANNELS, analog_channels, len);
 }
 
 int get_gyro_channels (int board_id, int *gyro_channels, int *len)
 {
-    return get_array_value (board_id, "gyro_channels", gyro_channels, len);
+    return get_array_value (board_id, ArrayValues::GYRO_CHANNELS, gyro_channels, len);
 }
 
 int get_other_channels (int board_id, int *other_channels, int *len)
 {
-    return get_array_value (board_id, "other_channels", other_channels, len);
+    return get_array_value (board_id, ArrayValues::OTHER_CHANNELS, other_channels, len);
 }
 
 int get_temperature_channels (int board_id, int *temperature_channels, int *len)
 {
-    return get_array_value (board_id, "temperature_channels", temperature_channels, len);
+    return get_array_value (board_id, ArrayValues::TEMPERATURE_CHANNELS, temperature_channels, len);
 }
 
 int get_resistance_channels (int board_id, int *resistance_channels, int *len)
 {
-    return get_array_value (board_id, "resistance_channels", resistance_channels, len);
+    return get_array_value (board_id, ArrayValues::RESISTANCE_CHANNELS, resistance_channels, len);
 }
 
 int get_exg_channels (int board_id, int *exg_channels, int *len)
 {
-    std::set<int> unique_channels;
-    const char *data_types[4] = {"eeg_channels", "emg_channels", "ecg_channels", "eog_channels"};
-    for (int i = 0; i < 4; i++)
+    *len = 0;
+    return get_array_value (board_id, ArrayValues::EXG_CHANNELS, exg_channels, len, false);
+}
+
+BoardDescriptors::BoardDescriptors ()
+{
+    min_board_id = 0;
+    std::vector<std::pair<int, BoardDescriptor>> parsed_descriptors;
+    for (auto &board : brainflow_boards_json["boards"].items ())
     {
-        int channels[4096] = {0};
-        int channels_len = 0;
-        int res = get_array_value (board_id, data_types[i], channels, &channels_len, false);
-        if (res == (int)BrainFlowExitCodes::STATUS_OK)
+        BoardDescriptor descriptor;
+        int board_id = std::stoi (board.key ());
+        const json &board_json = board.value ();
+        for (int i = 0; i < (int)SingleValues::NUM_VALUES; i++)
         {
-            for (int i = 0; i < channels_len; i++)
+            auto value = board_json.find (single_value_names[i]);
+            if ((value != board_json.end ()) && (value->is_number ()))
             {
-                unique_channels.insert (channels[i]);
+                descriptor.has_single_value[i] = true;
+                descriptor.single_values[i] = value->get<int> ();
             }
         }
+        for (int i = 0; i < (int)ArrayValues::NUM_VALUES; i++)
+        {
+            auto value = board_json.find (array_value_names[i]);
+            if ((value != board_json.end ()) && (value->is_array ()))
+            {
+                descriptor.has_array_value[i] = true;
+                descriptor.array_values[i] = value->get<std::vector<int>> ();
+            }
+        }
+        auto eeg_names = board_json.find ("eeg_names");
+        if ((eeg_names != board_json.end ()) && (eeg_names->is_string ()))
+        {
+            descriptor.has_eeg_names = true;
+            descriptor.eeg_names = eeg_names->get<std::string> ();
+        }
+        std::set<int> exg_channels;
+        int exg_types[4] = {(int)ArrayValues::EEG_CHANNELS, (int)ArrayValues::EMG_CHANNELS,
+            (int)ArrayValues::ECG_CHANNELS, (int)ArrayValues::EOG_CHANNELS};
+        for (int i = 0; i < 4; i++)
+        {
+            exg_channels.insert (descriptor.array_values[exg_types[i]].begin (),
+                descriptor.array_values[exg_types[i]].end ());
+        }
+        if (!exg_channels.empty ())
+        {
+            descriptor.has_array_value[(int)ArrayValues::EXG_CHANNELS] = true;
+            descriptor.array_values[(int)ArrayValues::EXG_CHANNELS] =
+                std::vector<int> (exg_channels.begin (), exg_channels.end ());
+        }
+        descriptor.is_valid = true;
+        min_board_id = std::min (min_board_id, board_id);
+        parsed_descriptors.push_back (std::make_pair (board_id, descriptor));
     }
-    int counter = 0;
-    for (std::set<int>::iterator it = unique_channels.begin (); it != unique_channels.end (); it++)
-    {
-        exg_channels[counter] = *it;
-        counter++;
-    }
-    *len = counter;
-    if (counter == 0)
+    for (size_t i = 0; i < parsed_descriptors.size (); i++)
     {
-        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+        size_t pos = (size_t)(parsed_descriptors[i].first - min_board_id);
+        if (pos >= descriptors.size ())
+        {
+            descriptors.resize (pos + 1);
+        }
+        descriptors[pos] = parsed_descriptors[i].second;
     }
-    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-inline std::string int_to_string (int val)
+inline const BoardDescriptor *get_board_descriptor (int board_id, bool use_logger)
 {
-    std::ostringstream ss;
-    ss << val;
-    return ss.str ();
+    const BoardDescriptor *descriptor = get_board_descriptors ().get (board_id);
+    if ((descriptor == NULL) && (use_logger))
+    {
+        Board::board_logger->error ("unsupported board id {}", board_id);
+    }
+    return descriptor;
 }
 
-inline int get_single_value (int board_id, const char *param_name, int *value, bool use_logger)
+inline int get_single_value (int board_id, SingleValues param, int *value, bool use_logger)
 {
-    try
+    const BoardDescriptor *descriptor = get_board_descriptor (board_id, use_logger);
+    if (descriptor == NULL)
     {
-        int val = (int)brainflow_boards_json["boards"][int_to_string (board_id)][param_name];
-        *value = val;
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
-    catch (json::exception &e)
+    if (!descriptor->has_single_value[(int)param])
     {
         if (use_logger)
         {
-            Board::board_logger->error (e.what ());
+            Board::board_logger->error (
+                "{} is not available for board {}", single_value_names[(int)param], board_id);
         }
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
+    *value = descriptor->single_values[(int)param];
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 inline int get_array_value (
-    int board_id, const char *param_name, int *output_array, int *len, bool use_logger)
+    int board_id, ArrayValues param, int *output_array, int *len, bool use_logger)
 {
-    try
+    const BoardDescriptor *descriptor = get_board_descriptor (board_id, use_logger);
+    if (descriptor == NULL)
     {
-        std::vector<int> values =
-            brainflow_boards_json["boards"][int_to_string (board_id)][param_name];
-        if (!values.empty ())
-        {
-            memcpy (output_array, &values[0], sizeof (int) * values.size ());
-        }
-        *len = values.size ();
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
-    catch (json::exception &e)
+    if (!descriptor->has_array_value[(int)param])
     {
         if (use_logger)
         {
-            Board::board_logger->error (e.what ());
+            Board::board_logger->error (
+                "{} are not available for board {}", array_value_names[(int)param], board_id);
         }
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
+    const std::vector<int> &values = descriptor->array_values[(int)param];
+    if (!values.empty ())
+    {
+        memcpy (output_array, &values[0], sizeof (int) * values.size ());
+    }
+    *len = (int)values.size ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-inline int get_string_value (
-    int board_id, const char *param_name, char *string, int *len, bool use_logger)
+inline int get_string_value (int board_id, char *string, int *len, bool use_logger)
 {
-    try
+    const BoardDescriptor *descriptor = get_board_descriptor (board_id, use_logger);
+    if (descriptor == NULL)
     {
-        std::string val = brainflow_boards_json["boards"][int_to_string (board_id)][param_name];
-        strcpy (string, val.c_str ());
-        *len = strlen (val.c_str ());
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
-    catch (json::exception &e)
+    if (!descriptor->has_eeg_names)
     {
         if (use_logger)
         {
-            Board::board_logger->error (e.what ());
+            Board::board_logger->error ("eeg_names are not available for board {}", board_id);
         }
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
-}
\ No newline at end of file
+    strcpy (string, descriptor->eeg_names.c_str ());
+    *len = (int)descriptor->eeg_names.size ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
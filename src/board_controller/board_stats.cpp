@@ -0,0 +1,165 @@
+#include <math.h>
+
+#include "board_stats.h"
+
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+
+BoardStats::BoardStats ()
+    : restart_flag (true),
+      package_num_index (-1),
+      samples_per_package_num (1),
+      num_samples (0),
+      num_gaps (0),
+      num_lost_samples (0),
+      num_duplicates (0),
+      num_out_of_order (0),
+      num_decode_errors (0),
+      mean_interval (0.0),
+      interval_std (0.0),
+      max_interval (0.0)
+{
+    has_previous = false;
+    previous_num = 0.0;
+    previous_timestamp = 0.0;
+    step = 0.0;
+    min_num = 0.0;
+    max_num = 0.0;
+    num_repeats = 0;
+    num_intervals = 0;
+    intervals_mean = 0.0;
+    intervals_m2 = 0.0;
+}
+
+void BoardStats::restart (int package_num_index, int samples_per_package_num)
+{
+    // writer thread is not running yet or still finishing, so writer state is reset by writer
+    this->package_num_index.store (package_num_index, std::memory_order_relaxed);
+    this->samples_per_package_num.store (
+        (samples_per_package_num < 1) ? 1 : samples_per_package_num, std::memory_order_relaxed);
+    restart_flag.store (true, std::memory_order_release);
+}
+
+void BoardStats::on_samples (
+    const double *timestamps, const double *samples, size_t n, size_t num_channels)
+{
+    if (restart_flag.exchange (false, std::memory_order_acquire))
+    {
+        has_previous = false;
+        step = 0.0;
+        max_num = 0.0;
+        num_repeats = 0;
+    }
+    int index = package_num_index.load (std::memory_order_relaxed);
+    bool check_num = (index >= 0) && ((size_t)index < num_channels);
+    int max_repeats = samples_per_package_num.load (std::memory_order_relaxed) - 1;
+    for (size_t i = 0; i < n; i++)
+    {
+        bool is_skipped = false;
+        if ((has_previous) && (check_num))
+        {
+            is_skipped = check_package_num (samples[i * num_channels + index], max_repeats);
+        }
+        // only the first sample of each package num is used for timing, reordered sample should
+        // not move the sequence back
+        if (is_skipped)
+        {
+            continue;
+        }
+        if (check_num)
+        {
+            double package_num = samples[i * num_channels + index];
+            min_num = ((!has_previous) || (package_num < min_num)) ? package_num : min_num;
+            max_num = ((!has_previous) || (package_num > max_num)) ? package_num : max_num;
+            previous_num = package_num;
+        }
+        if (has_previous)
+        {
+            check_timestamp (timestamps[i]);
+        }
+        has_previous = true;
+        previous_timestamp = timestamps[i];
+    }
+    num_samples.fetch_add (n, std::memory_order_relaxed);
+}
+
+bool BoardStats::check_package_num (double package_num, int max_repeats)
+{
+    double diff = package_num - previous_num;
+    if (diff == 0.0)
+    {
+        // some boards send several samples with the same package num
+        num_repeats++;
+        if (num_repeats <= max_repeats)
+        {
+            return true;
+        }
+        // boards without counter send the same value all the time, so step should be known
+        if (step > 0.0)
+        {
+            num_duplicates.fetch_add (1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+    num_repeats = 0;
+    double distance = diff;
+    if (diff < 0.0)
+    {
+        // counters wrap around from max to min value, small step back is a reordering
+        if (previous_num - package_num <= (max_num - min_num) / 2.0)
+        {
+            num_out_of_order.fetch_add (1, std::memory_order_relaxed);
+            return true;
+        }
+        distance = max_num - previous_num + package_num - min_num + step;
+    }
+    else if ((step == 0.0) || (diff < step))
+    {
+        // some boards increment counter by more than one, min positive diff is a step
+        step = diff;
+    }
+    if ((step > 0.0) && (distance > step))
+    {
+        num_gaps.fetch_add (1, std::memory_order_relaxed);
+        double lost = round (distance / step) - 1.0;
+        if (lost > 0.0)
+        {
+            num_lost_samples.fetch_add ((uint64_t)lost, std::memory_order_relaxed);
+        }
+    }
+    return false;
+}
+
+void BoardStats::check_timestamp (double timestamp)
+{
+    // welford's algorithm
+    double interval = timestamp - previous_timestamp;
+    num_intervals++;
+    double delta = interval - intervals_mean;
+    intervals_mean += delta / num_intervals;
+    intervals_m2 += delta * (interval - intervals_mean);
+    mean_interval.store (intervals_mean, std::memory_order_relaxed);
+    interval_std.store (sqrt (intervals_m2 / num_intervals), std::memory_order_relaxed);
+    if (interval > max_interval.load (std::memory_order_relaxed))
+    {
+        max_interval.store (interval, std::memory_order_relaxed);
+    }
+}
+
+std::string BoardStats::to_json ()
+{
+    json j;
+    j["num_samples"] = num_samples.load (std::memory_order_relaxed);
+    j["num_gaps"] = num_gaps.load (std::memory_order_relaxed);
+    j["num_lost_samples"] = num_lost_samples.load (std::memory_order_relaxed);
+    j["num_duplicates"] = num_duplicates.load (std::memory_order_relaxed);
+    j["num_out_of_order"] = num_out_of_order.load (std::memory_order_relaxed);
+    j["num_decode_errors"] = num_decode_errors.load (std::memory_order_relaxed);
+    j["mean_interval"] = mean_interval.load (std::memory_order_relaxed);
+    j["interval_std"] = interval_std.load (std::memory_order_relaxed);
+    j["max_interval"] = max_interval.load (std::memory_order_relaxed);
+    return j.dump ();
+}
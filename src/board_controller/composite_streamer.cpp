@@ -0,0 +1,47 @@
+#include "brainflow_constants.h"
+#include "composite_streamer.h"
+
+
+CompositeStreamer::CompositeStreamer (std::vector<Streamer *> streamers) : Streamer ()
+{
+    this->streamers = streamers;
+}
+
+CompositeStreamer::~CompositeStreamer ()
+{
+    for (size_t i = 0; i < streamers.size (); i++)
+    {
+        delete streamers[i];
+    }
+    streamers.clear ();
+}
+
+int CompositeStreamer::init_streamer ()
+{
+    for (size_t i = 0; i < streamers.size (); i++)
+    {
+        int res = streamers[i]->init_streamer ();
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void CompositeStreamer::stream_data (double *data, int len, double timestamp)
+{
+    for (size_t i = 0; i < streamers.size (); i++)
+    {
+        streamers[i]->stream_data (data, len, timestamp);
+    }
+}
+
+void CompositeStreamer::stream_data_batch (
+    double *data, int len, double *timestamps, int num_samples)
+{
+    for (size_t i = 0; i < streamers.size (); i++)
+    {
+        streamers[i]->stream_data_batch (data, len, timestamps, num_samples);
+    }
+}
@@ -1,18 +1,41 @@
+#include <algorithm>
+#include <stdint.h>
 #include <string.h>
 
+#include "board.h"
 #include "brainflow_constants.h"
 #include "file_streamer.h"
 
 
-FileStreamer::FileStreamer (const char *file, const char *file_mode) : Streamer ()
+constexpr int FileStreamer::max_queue_size;
+constexpr int FileStreamer::initial_queue_seconds;
+constexpr int FileStreamer::binary_format_version;
+
+
+FileStreamer::FileStreamer (const char *file, const char *file_mode, int board_id) : Streamer ()
 {
     strcpy (this->file, file);
     strcpy (this->file_mode, file_mode);
+    this->board_id = board_id;
     fp = NULL;
+    is_binary = false;
+    is_float = false;
+    num_rows = 0;
+    num_dropped = 0;
+    keep_alive = false;
 }
 
 FileStreamer::~FileStreamer ()
 {
+    if (keep_alive)
+    {
+        {
+            std::lock_guard<std::mutex> lk (m);
+            keep_alive = false;
+        }
+        cv.notify_one ();
+        writer_thread.join ();
+    }
     if (fp != NULL)
     {
         fclose (fp);
@@ -21,24 +44,219 @@ FileStreamer::~FileStreamer ()
 
 int FileStreamer::init_streamer ()
 {
-    if ((strcmp (file_mode, "w") != 0) && (strcmp (file_mode, "w+") != 0) &&
+    const char *fopen_mode = file_mode;
+    if ((strcmp (file_mode, "wb") == 0) || (strcmp (file_mode, "ab") == 0))
+    {
+        is_binary = true;
+    }
+    else if (strcmp (file_mode, "wbf") == 0)
+    {
+        is_binary = true;
+        is_float = true;
+        fopen_mode = "wb";
+    }
+    else if (strcmp (file_mode, "abf") == 0)
+    {
+        is_binary = true;
+        is_float = true;
+        fopen_mode = "ab";
+    }
+    else if ((strcmp (file_mode, "w") != 0) && (strcmp (file_mode, "w+") != 0) &&
         (strcmp (file_mode, "a") != 0) && (strcmp (file_mode, "a+") != 0))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    fp = fopen (file, file_mode);
+    if (fopen_mode[0] == 'a')
+    {
+        int res = check_existing_file ();
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    fp = fopen (file, fopen_mode);
     if (fp == NULL)
     {
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    int sampling_rate = 0;
+    int expected_rows = 0;
+    size_t initial_size = 0;
+    if ((get_sampling_rate (board_id, &sampling_rate) == (int)BrainFlowExitCodes::STATUS_OK) &&
+        (get_num_rows (board_id, &expected_rows) == (int)BrainFlowExitCodes::STATUS_OK))
+    {
+        initial_size = std::min ((size_t)FileStreamer::max_queue_size,
+            (size_t)FileStreamer::initial_queue_seconds * sampling_rate * expected_rows);
+    }
+    queue.reserve (initial_size);
+    write_buffer.reserve (initial_size);
+    keep_alive = true;
+    writer_thread = std::thread ([this] { this->write_thread (); });
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int FileStreamer::check_existing_file ()
+{
+    FILE *existing_fp = fopen (file, "rb");
+    // new file
+    if (existing_fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    char magic[4] = {0};
+    int32_t header[4] = {0};
+    size_t magic_len = fread (magic, 1, 4, existing_fp);
+    size_t header_len = fread (header, sizeof (int32_t), 4, existing_fp);
+    fclose (existing_fp);
+    if (magic_len == 0)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    bool is_binary_file = (magic_len == 4) && (memcmp (magic, "BFSB", 4) == 0);
+    if (!is_binary)
+    {
+        if (is_binary_file)
+        {
+            Board::board_logger->error ("can not append csv data to binary file {}", file);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    if ((!is_binary_file) || (header_len != 4))
+    {
+        Board::board_logger->error ("file {} is not empty and has no binary header", file);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int expected_rows = 0;
+    if (get_num_rows (board_id, &expected_rows) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+    }
+    int32_t value_size = (int32_t)(is_float ? sizeof (float) : sizeof (double));
+    if ((header[0] != FileStreamer::binary_format_version) || (header[1] != board_id) ||
+        (header[2] != expected_rows) || (header[3] != value_size))
+    {
+        Board::board_logger->error (
+            "header of {}: version {}, board id {}, num rows {}, value size {} doesnt match "
+            "version {}, board id {}, num rows {}, value size {}",
+            file, header[0], header[1], header[2], header[3], FileStreamer::binary_format_version,
+            board_id, expected_rows, value_size);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void FileStreamer::stream_data (double *data, int len, double timestamp)
 {
-    for (int i = 0; i < len; i++)
+    stream_data_batch (data, len, &timestamp, 1);
+}
+
+void FileStreamer::stream_data_batch (double *data, int len, double *timestamps, int num_samples)
+{
+    {
+        std::lock_guard<std::mutex> lk (m);
+        if (num_rows == 0)
+        {
+            num_rows = len + 1;
+        }
+        if (queue.size () + (size_t)(num_samples * (len + 1)) > (size_t)max_queue_size)
+        {
+            num_dropped += num_samples;
+            return;
+        }
+        for (int i = 0; i < num_samples; i++)
+        {
+            queue.insert (queue.end (), data + i * len, data + (i + 1) * len);
+            queue.push_back (timestamps[i]);
+        }
+    }
+    cv.notify_one ();
+}
+
+void FileStreamer::write_thread ()
+{
+    bool header_written = false;
+    long long num_reported_drops = 0;
+    while (true)
+    {
+        long long cur_dropped = 0;
+        bool stop = false;
+        {
+            std::unique_lock<std::mutex> lk (m);
+            cv.wait (lk, [this] { return ((!queue.empty ()) || (!keep_alive)); });
+            // queue is empty after swap, capacity is kept so there are no allocations
+            write_buffer.swap (queue);
+            cur_dropped = num_dropped;
+            stop = !keep_alive;
+        }
+        if ((!header_written) && (!write_buffer.empty ()))
+        {
+            write_header ();
+            header_written = true;
+        }
+        write_rows (write_buffer.data (), write_buffer.size ());
+        write_buffer.clear ();
+        if ((cur_dropped != num_reported_drops) && (!stop))
+        {
+            Board::board_logger->warn (
+                "file streamer can not keep up, {} samples dropped", cur_dropped);
+            num_reported_drops = cur_dropped;
+        }
+        if (stop)
+        {
+            break;
+        }
+    }
+    fflush (fp);
+}
+
+void FileStreamer::write_header ()
+{
+    if (!is_binary)
     {
-        fprintf (fp, "%lf,", data[i]);
+        return;
     }
-    fprintf (fp, "%lf\n", timestamp);
-}
\ No newline at end of file
+    // in append mode header is written only for new or empty file, existing header was validated
+    // in init_streamer
+    fseek (fp, 0, SEEK_END);
+    if (ftell (fp) != 0)
+    {
+        return;
+    }
+    int32_t header[4] = {(int32_t)FileStreamer::binary_format_version, (int32_t)board_id,
+        (int32_t)num_rows, (int32_t)(is_float ? sizeof (float) : sizeof (double))};
+    fwrite ("BFSB", 1, 4, fp);
+    fwrite (header, sizeof (int32_t), 4, fp);
+}
+
+void FileStreamer::write_rows (const double *values, size_t num_values)
+{
+    if (num_values == 0)
+    {
+        return;
+    }
+    if (!is_binary)
+    {
+        for (size_t i = 0; i < num_values; i++)
+        {
+            fprintf (fp, ((i + 1) % num_rows == 0) ? "%lf\n" : "%lf,", values[i]);
+        }
+    }
+    else if (!is_float)
+    {
+        fwrite (values, sizeof (double), num_values, fp);
+    }
+    else
+    {
+        float chunk[1024];
+        for (size_t offset = 0; offset < num_values; offset += 1024)
+        {
+            size_t chunk_len = std::min ((size_t)1024, num_values - offset);
+            for (size_t i = 0; i < chunk_len; i++)
+            {
+                chunk[i] = (float)values[offset + i];
+            }
+            fwrite (chunk, sizeof (float), chunk_len, fp);
+        }
+    }
+}
@@ -4,6 +4,7 @@
 #include "custom_cast.h"
 #include "freeeeg32.h"
 #include "serial.h"
+#include "serial_packet_reader.h"
 #include "timestamp.h"
 
 
@@ -91,7 +92,7 @@ int FreeEEG32::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (FreeEEG32::num_channels, buffer_size);
+    db = new DataBuffer (FreeEEG32::num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -151,54 +152,57 @@ int FreeEEG32::release_session ()
 
 void FreeEEG32::read_thread ()
 {
-    int res;
-    constexpr int max_size = 200; // random value bigger than package size which is unknown
-    unsigned char b[max_size] = {0};
+    SerialPacketReader reader (serial);
     // dont know exact package size and it can be changed with new firmware versions, its >=
     // min_package_size and we can check start\stop bytes
-    constexpr int min_package_size = 1 + 32 * 3;
+    constexpr int min_package_size = 1 + 1 + 32 * 3;
+    constexpr int max_package_size = 200; // random value bigger than package size
     float eeg_scale =
         FreeEEG32::ads_vref / float((pow (2, 23) - 1)) / FreeEEG32::ads_gain * 1000000.;
-    double package[FreeEEG32::num_channels] = {0.0};
+    // packages which are already received are added to buffer and streamer at once
+    constexpr int max_batch_size = 64;
+    double packages[max_batch_size * FreeEEG32::num_channels] = {0.0};
+    double timestamps[max_batch_size] = {0.0};
+    int batch_size = 0;
     bool first_package_received = false;
 
     while (keep_alive)
     {
-        int pos = 0;
-        bool complete_package = false;
-        while ((keep_alive) && (pos < max_size - 2))
-        {
-            res = serial->read_from_serial_port (b + pos, 1);
-            int prev_id = (pos <= 0) ? 0 : pos - 1;
-            if ((b[pos] == FreeEEG32::start_byte) && (b[prev_id] == FreeEEG32::end_byte) &&
-                (pos >= min_package_size))
-            {
-                complete_package = true;
-                break;
-            }
-            pos += res;
-        }
-        if (complete_package)
+        const unsigned char *package_bytes = NULL;
+        int package_size = reader.peek_delimited_packet (FreeEEG32::start_byte,
+            FreeEEG32::end_byte, min_package_size, max_package_size, &package_bytes);
+        if (package_size > 0)
         {
             // handle the case that we start reading in the middle of data stream
-            if (!first_package_received)
+            if (first_package_received)
             {
-                first_package_received = true;
-                continue;
+                // skip start byte
+                const unsigned char *b = package_bytes + 1;
+                double *package = packages + batch_size * FreeEEG32::num_channels;
+                package[0] = (double)b[0];
+                for (int i = 0; i < 32; i++)
+                {
+                    package[i + 1] = eeg_scale * cast_24bit_to_int32 (b + 1 + 3 * i);
+                }
+                timestamps[batch_size] = get_timestamp ();
+                batch_size++;
             }
-            package[0] = (double)b[0];
-            for (int i = 0; i < 32; i++)
-            {
-                package[i + 1] = eeg_scale * cast_24bit_to_int32 (b + 1 + 3 * i);
-            }
-            double timestamp = get_timestamp ();
-            db->add_data (timestamp, package);
-            streamer->stream_data (package, FreeEEG32::num_channels, timestamp);
+            first_package_received = true;
+            reader.consume (package_size);
         }
         else
         {
-            safe_logger (
-                spdlog::level::trace, "stopped with pos: {}, keep_alive: {}", pos, keep_alive);
+            safe_logger (spdlog::level::trace, "no complete package, keep_alive: {}", keep_alive);
+        }
+        // next call may wait for data from port if there is no complete package in buffer
+        if ((batch_size > 0) &&
+            ((reader.get_num_buffered () < max_package_size) ||
+                (batch_size == max_batch_size) || (!keep_alive)))
+        {
+            streamer->stream_data_batch (
+                packages, FreeEEG32::num_channels, timestamps, batch_size);
+            db->add_data_batch (timestamps, packages, batch_size);
+            batch_size = 0;
         }
     }
 }
@@ -45,4 +45,5 @@ public:
     int config_board (std::string config, std::string &response);
 
     static constexpr int package_size = 17; // from unicorn.h
+    static constexpr int num_scans = 5;     // scans read at once, 20ms for 250Hz
 };
@@ -13,6 +13,7 @@
 
 
 constexpr int UnicornBoard::package_size;
+constexpr int UnicornBoard::num_scans;
 
 
 UnicornBoard::UnicornBoard (struct BrainFlowInputParams params)
@@ -109,7 +110,7 @@ int UnicornBoard::start_stream (int buffer_size, char *streamer_params)
         return res;
     }
 
-    db = new DataBuffer (UnicornBoard::package_size, buffer_size);
+    db = new DataBuffer (UnicornBoard::package_size, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         Board::board_logger->error ("Unable to prepare buffer with size {}", buffer_size);
@@ -165,41 +166,52 @@ int UnicornBoard::release_session ()
 
 void UnicornBoard::read_thread ()
 {
-    double package[UnicornBoard::package_size];
-    float temp_buffer[UnicornBoard::package_size];
+    double packages[UnicornBoard::num_scans * UnicornBoard::package_size];
+    double timestamps[UnicornBoard::num_scans];
+    float temp_buffer[UnicornBoard::num_scans * UnicornBoard::package_size];
 
     while (keep_alive)
     {
         // unicorn uses similar idea as in brainflow - return single array with different kinds of
         // data and provide API(defines in this case) to mark this data
-        func_get_data (device_handle, 1, temp_buffer, UnicornBoard::package_size * sizeof (float));
+        func_get_data (device_handle, UnicornBoard::num_scans, temp_buffer,
+            UnicornBoard::num_scans * UnicornBoard::package_size);
         double timestamp = get_timestamp ();
-        // eeg data
-        package[0] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX];
-        package[1] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 1];
-        package[2] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 2];
-        package[3] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 3];
-        package[4] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 4];
-        package[5] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 5];
-        package[6] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 6];
-        package[7] = (double)temp_buffer[UNICORN_EEG_CONFIG_INDEX + 7];
-        // accel data
-        package[8] = (double)temp_buffer[UNICORN_ACCELEROMETER_CONFIG_INDEX];
-        package[9] = (double)temp_buffer[UNICORN_ACCELEROMETER_CONFIG_INDEX + 1];
-        package[10] = (double)temp_buffer[UNICORN_ACCELEROMETER_CONFIG_INDEX + 2];
-        // gyro data
-        package[11] = (double)temp_buffer[UNICORN_GYROSCOPE_CONFIG_INDEX];
-        package[12] = (double)temp_buffer[UNICORN_GYROSCOPE_CONFIG_INDEX + 1];
-        package[13] = (double)temp_buffer[UNICORN_GYROSCOPE_CONFIG_INDEX + 2];
-        // battery data
-        package[14] = (double)temp_buffer[UNICORN_BATTERY_CONFIG_INDEX];
-        // counter / package num
-        package[15] = (double)temp_buffer[UNICORN_COUNTER_CONFIG_INDEX];
-        // validation config index? place it to other channels
-        package[16] = (double)temp_buffer[UNICORN_VALIDATION_CONFIG_INDEX];
-
-        db->add_data (timestamp, package);
-        streamer->stream_data (package, UnicornBoard::package_size, timestamp);
+        for (int scan = 0; scan < UnicornBoard::num_scans; scan++)
+        {
+            float *scan_buffer = temp_buffer + scan * UnicornBoard::package_size;
+            double *package = packages + scan * UnicornBoard::package_size;
+            // eeg data
+            package[0] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX];
+            package[1] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 1];
+            package[2] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 2];
+            package[3] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 3];
+            package[4] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 4];
+            package[5] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 5];
+            package[6] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 6];
+            package[7] = (double)scan_buffer[UNICORN_EEG_CONFIG_INDEX + 7];
+            // accel data
+            package[8] = (double)scan_buffer[UNICORN_ACCELEROMETER_CONFIG_INDEX];
+            package[9] = (double)scan_buffer[UNICORN_ACCELEROMETER_CONFIG_INDEX + 1];
+            package[10] = (double)scan_buffer[UNICORN_ACCELEROMETER_CONFIG_INDEX + 2];
+            // gyro data
+            package[11] = (double)scan_buffer[UNICORN_GYROSCOPE_CONFIG_INDEX];
+            package[12] = (double)scan_buffer[UNICORN_GYROSCOPE_CONFIG_INDEX + 1];
+            package[13] = (double)scan_buffer[UNICORN_GYROSCOPE_CONFIG_INDEX + 2];
+            // battery data
+            package[14] = (double)scan_buffer[UNICORN_BATTERY_CONFIG_INDEX];
+            // counter / package num
+            package[15] = (double)scan_buffer[UNICORN_COUNTER_CONFIG_INDEX];
+            // validation config index? place it to other channels
+            package[16] = (double)scan_buffer[UNICORN_VALIDATION_CONFIG_INDEX];
+            // the last scan is the newest one, previous scans were sampled earlier
+            timestamps[scan] = timestamp -
+                (double)(UnicornBoard::num_scans - 1 - scan) / (double)UNICORN_SAMPLING_RATE;
+        }
+
+        db->add_data_batch (timestamps, packages, UnicornBoard::num_scans);
+        streamer->stream_data_batch (
+            packages, UnicornBoard::package_size, timestamps, UnicornBoard::num_scans);
     }
 }
 
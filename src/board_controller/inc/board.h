@@ -4,6 +4,7 @@
 
 #include "board_controller.h"
 #include "board_info_getter.h"
+#include "board_stats.h"
 #include "brainflow_constants.h"
 #include "brainflow_input_params.h"
 #include "data_buffer.h"
@@ -41,6 +42,8 @@ public:
         skip_logs = false;
         db = NULL;       // should be initialized in start_stream
         streamer = NULL; // should be initialized in start_stream
+        buffer_layout = BufferLayouts::INTERLEAVED;
+        samples_per_package_num = 1;
         this->board_id = board_id;
         this->params = params;
     }
@@ -53,7 +56,15 @@ public:
     int get_current_board_data (int num_samples, double *data_buf, int *returned_samples);
     int get_board_data_count (int *result);
     int get_board_data (int data_count, double *data_buf);
+    int create_reader (int *reader_id);
+    int release_reader (int reader_id);
+    int read_new_samples (int reader_id, int max_samples, double *data_buf, int *returned_samples);
     int prepare_streamer (char *streamer_params);
+    // applied to DataBuffer created in the next start_stream call
+    int set_buffer_layout (int layout);
+    // should be called before start_stream, stats are collected from samples added to db
+    void start_stats ();
+    int get_board_stats (std::string &board_stats);
 
     // Board::board_logger should not be called from destructors, to ensure that there are safe log
     // methods Board::board_logger still available but should be used only outside destructors
@@ -81,9 +92,13 @@ protected:
     int board_id;
     struct BrainFlowInputParams params;
     Streamer *streamer;
+    BufferLayouts buffer_layout;
+    // pass it to DataBuffer constructor, decode errors should be added by boards
+    BoardStats stats;
+    // boards which add several samples with the same package num should change it
+    int samples_per_package_num;
 
 private:
-    // reshapes data from DataBuffer format where all channels are mixed to linear buffer with
-    // sorted data
-    void reshape_data (int data_count, const double *buf, const double *ts_buf, double *output_buf);
+    // creates single streamer from streamer_type://streamer_dest:streamer_args
+    int create_streamer (std::string streamer_params, Streamer **new_streamer);
 };
@@ -16,6 +16,8 @@ extern "C"
         int board_id, char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION start_stream (
         int buffer_size, char *streamer_params, int board_id, char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION set_buffer_layout (
+        int layout, int board_id, char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION stop_stream (
         int board_id, char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION release_session (
@@ -26,8 +28,18 @@ extern "C"
         int *result, int board_id, char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION get_board_data (
         int data_count, double *data_buf, int board_id, char *json_brainflow_input_params);
+    // non destructive readers, each reader gets every new sample once and doesnt affect others
+    SHARED_EXPORT int CALLING_CONVENTION create_reader (
+        int *reader_id, int board_id, char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION read_new_samples (int reader_id, int max_samples,
+        double *data_buf, int *returned_samples, int board_id, char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION release_reader (
+        int reader_id, int board_id, char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION config_board (char *config, char *response,
         int *response_len, int board_id, char *json_brainflow_input_params);
+    // json with counters of lost and broken packages and sampling jitter
+    SHARED_EXPORT int CALLING_CONVENTION get_board_stats (
+        char *board_stats, int *board_stats_len, int board_id, char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION is_prepared (
         int *prepared, int board_id, char *json_brainflow_input_params);
 
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+
+#include "data_buffer.h"
+
+
+// counters of lost, duplicated and broken packages and timing jitter for a single board. Samples
+// are checked by DataBuffer producer thread(single writer), decode errors can be added from any
+// thread, counters can be read at any time. No locks, so it stays enabled during streaming
+class BoardStats : public DataBufferObserver
+{
+public:
+    BoardStats ();
+
+    // called before each start_stream, counters are not reset, only sequence and timing are
+    // tracked from scratch. package_num_index < 0 disables gap detection, some boards add
+    // several samples with the same package num, they are not duplicates
+    void restart (int package_num_index, int samples_per_package_num = 1);
+    void add_decode_error ()
+    {
+        num_decode_errors.fetch_add (1, std::memory_order_relaxed);
+    }
+    void on_samples (
+        const double *timestamps, const double *samples, size_t n, size_t num_channels);
+    std::string to_json ();
+
+private:
+    // accessed only by writer
+    bool has_previous;
+    double previous_num;
+    double previous_timestamp;
+    double step;
+    double min_num;
+    double max_num;
+    int num_repeats;
+    uint64_t num_intervals;
+    double intervals_mean;
+    double intervals_m2;
+
+    std::atomic<bool> restart_flag;
+    std::atomic<int> package_num_index;
+    std::atomic<int> samples_per_package_num;
+    std::atomic<uint64_t> num_samples;
+    std::atomic<uint64_t> num_gaps;
+    std::atomic<uint64_t> num_lost_samples;
+    std::atomic<uint64_t> num_duplicates;
+    std::atomic<uint64_t> num_out_of_order;
+    std::atomic<uint64_t> num_decode_errors;
+    std::atomic<double> mean_interval;
+    std::atomic<double> interval_std;
+    std::atomic<double> max_interval;
+
+    // returns true if sample doesnt start a new package: repeat, duplicate or reordered sample
+    bool check_package_num (double package_num, int max_repeats);
+    void check_timestamp (double timestamp);
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "streamer.h"
+
+
+// dispatches each sample to all streamers, owns them. Streamers which can be slow(file) write data
+// in their own threads, so the order of streamers doesnt matter
+class CompositeStreamer : public Streamer
+{
+
+public:
+    CompositeStreamer (std::vector<Streamer *> streamers);
+    ~CompositeStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data, int len, double timestamp);
+    void stream_data_batch (double *data, int len, double *timestamps, int num_samples);
+
+private:
+    std::vector<Streamer *> streamers;
+};
@@ -1,22 +1,58 @@
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <stdio.h>
+#include <thread>
+#include <vector>
 
 #include "streamer.h"
 
 
+// samples are queued by acquisition thread and written to disk by separate writer thread
+// modes "w", "w+", "a", "a+" - csv file, modes "wb", "ab" - binary file with doubles, modes "wbf",
+// "abf" - binary file with floats. Binary file starts with header: magic "BFSB", format version,
+// board id, number of rows, size of value, all of them are int32 except magic, and after header
+// there are rows of samples with timestamp at the end like in csv file. In append mode header of
+// existing file should match board and value size, csv and binary files can not be mixed
 class FileStreamer : public Streamer
 {
 
 public:
-    FileStreamer (const char *file, const char *file_mode);
+    FileStreamer (const char *file, const char *file_mode, int board_id);
     ~FileStreamer ();
 
     int init_streamer ();
     void stream_data (double *data, int len, double timestamp);
+    void stream_data_batch (double *data, int len, double *timestamps, int num_samples);
+
+    // samples which dont fit to the queue are dropped to never block acquisition thread, queue
+    // grows on demand, initially memory is reserved for initial_queue_seconds of data
+    static constexpr int max_queue_size = 1000000; // number of values
+    static constexpr int initial_queue_seconds = 1;
+    static constexpr int binary_format_version = 1;
 
 private:
     char file[128];
     char file_mode[128];
+    int board_id;
     FILE *fp;
+    bool is_binary;
+    bool is_float;
+    int num_rows;
+
+    // writer swaps queue with its own buffer and writes it without holding the lock
+    std::vector<double> queue;
+    std::vector<double> write_buffer;
+    long long num_dropped;
+    volatile bool keep_alive;
+    std::thread writer_thread;
+    std::mutex m;
+    std::condition_variable cv;
+
+    // validates header of existing file in append mode
+    int check_existing_file ();
+    void write_thread ();
+    void write_header ();
+    void write_rows (const double *values, size_t num_values);
 };
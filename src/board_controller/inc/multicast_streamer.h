@@ -1,22 +1,54 @@
 #pragma once
 
+#include <stdint.h>
+
 #include "multicast_server.h"
 
 #include "streamer.h"
 
 
+#define MULTICAST_PACKAGE_MAGIC 0x434D4642 // "BFMC"
+#define MULTICAST_PACKAGE_VERSION 1
+
+// with batch_size 1 datagram is a single row of num_rows doubles without header, it's compatible
+// with older receivers. With bigger batch size each datagram starts with this header, followed by
+// num_samples rows of num_rows doubles with timestamp in the last row, all values are in host byte
+// order. Header size is a multiple of 8, so it can not be confused with a row without header
+struct MultiCastPackageHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t num_samples;
+    uint16_t num_rows;
+    uint16_t reserved;
+    uint32_t sequence_num;
+};
+
 class MultiCastStreamer : public Streamer
 {
 
 public:
-    MultiCastStreamer (const char *ip, int port);
+    MultiCastStreamer (const char *ip, int port, int batch_size = 1);
     ~MultiCastStreamer ();
 
     int init_streamer ();
     void stream_data (double *data, int len, double timestamp);
+    void stream_data_batch (double *data, int len, double *timestamps, int num_samples);
+
+    // keep datagram smaller than max udp payload
+    static constexpr int max_package_size = 65000;
 
 private:
     char ip[128];
     int port;
+    int batch_size;
     MultiCastServer *server;
+
+    // preallocated datagram, samples are accumulated here until batch is full
+    unsigned char *send_buffer;
+    int num_rows;
+    int num_buffered;
+    uint32_t sequence_num;
+
+    void send_batch ();
 };
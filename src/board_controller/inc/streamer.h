@@ -13,4 +13,12 @@ public:
 
     virtual int init_streamer () = 0;
     virtual void stream_data (double *data, int len, double timestamp) = 0;
+    // data contains num_samples packages of len elements one after another
+    virtual void stream_data_batch (double *data, int len, double *timestamps, int num_samples)
+    {
+        for (int i = 0; i < num_samples; i++)
+        {
+            stream_data (data + i * len, len, timestamps[i]);
+        }
+    }
 };
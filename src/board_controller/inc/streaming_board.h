@@ -1,9 +1,12 @@
 #pragma once
 
+#include <stdint.h>
 #include <thread>
+#include <vector>
 
 #include "board.h"
 #include "board_controller.h"
+#include "io_reactor.h"
 #include "multicast_client.h"
 
 
@@ -15,10 +18,41 @@ private:
     bool initialized;
     bool is_streaming;
     std::thread streaming_thread;
+    IOReactor *reactor; // not NULL if socket is registered in reactor instead of thread
 
     MultiCastClient *client;
+    // up to max_batch_size datagrams are received by one recv_batch call
+    static constexpr int max_batch_size = 16;
+    DatagramBatch *batch;
+
+    // format for incomming package is determined by original board
+    int num_rows;
+    int timestamp_channel;
+    int max_samples;
+    // rows from datagram without timestamps, in the format expected by add_data_batch
+    std::vector<double> samples;
+    std::vector<double> timestamps;
+    bool is_first_package;
+    uint32_t expected_sequence_num;
+    // datagrams with unknown format are logged with warn level only once per stream
+    bool is_format_error_logged;
 
     void read_thread ();
+    // handles received datagrams until recv fails, with reactor socket is non blocking
+    void read_packages ();
+    void on_reactor_event (bool is_hung_up);
+    void handle_package (const unsigned char *package, int size);
+    void add_rows (const unsigned char *rows, int num_samples);
+
+    template <typename... Args> void report_format_error (const char *fmt, const Args &... args)
+    {
+        stats.add_decode_error ();
+        // if sender uses incompatible version all datagrams are dropped, user should see it
+        spdlog::level::level_enum level =
+            (is_format_error_logged) ? spdlog::level::trace : spdlog::level::warn;
+        is_format_error_logged = true;
+        safe_logger (level, fmt, args...);
+    }
 
 public:
     StreamingBoard (struct BrainFlowInputParams params);
@@ -22,4 +22,7 @@ public:
     void stream_data (double *data, int size, double timestamp)
     {
     }
+    void stream_data_batch (double *data, int len, double *timestamps, int num_samples)
+    {
+    }
 };
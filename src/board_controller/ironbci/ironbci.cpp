@@ -3,6 +3,7 @@
 #include "custom_cast.h"
 #include "ironbci.h"
 #include "serial.h"
+#include "serial_packet_reader.h"
 #include "timestamp.h"
 
 constexpr int IronBCI::num_channels;
@@ -119,7 +120,7 @@ int IronBCI::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (IronBCI::num_channels, buffer_size);
+    db = new DataBuffer (IronBCI::num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "Unable to prepare buffer");
@@ -196,42 +197,28 @@ void IronBCI::read_thread ()
         Bytes 23-25: Data value for EEG channel 8
         Byte 26: 0xC0
     */
-    int res;
-    unsigned char b[26];
+    SerialPacketReader reader (serial);
     float eeg_scale = 4.5 / float((pow (2, 23) - 1)) / IronBCI::ads_gain * 1000000.;
     while (keep_alive)
     {
-        // check start byte
-        res = serial->read_from_serial_port (b, 1);
-        if (res != 1)
+        // start byte and remaining 26 bytes
+        const unsigned char *package_bytes = NULL;
+        if (reader.peek_packet (IronBCI::start_byte, 27, &package_bytes) != 27)
         {
-            safe_logger (spdlog::level::debug, "Unable to read 1 byte");
             continue;
         }
-        if (b[0] != IronBCI::start_byte)
-        {
-            continue;
-        }
-
-        // read remaining 26 bytes
-        int remaining_bytes = 26;
-        int pos = 0;
-        while ((remaining_bytes > 0) && (keep_alive))
-        {
-            res = serial->read_from_serial_port (b + pos, remaining_bytes);
-            remaining_bytes -= res;
-            pos += res;
-        }
-        if (!keep_alive)
-        {
-            return;
-        }
+        const unsigned char *b = package_bytes + 1;
         // check stop byte
         if (b[25] != IronBCI::stop_byte)
         {
             safe_logger (spdlog::level::warn, "Wrong end byte {}", b[25]);
+            stats.add_decode_error ();
+            // start byte was wrong, search for the next one
+            reader.consume (1);
             continue;
         }
+        // bytes stay in buffer until the next read
+        reader.consume (27);
 
         double package[IronBCI::num_channels] = {0.};
         // package num
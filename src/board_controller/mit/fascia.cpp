@@ -94,7 +94,7 @@ int Fascia::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (Fascia::num_channels, buffer_size);
+    db = new DataBuffer (Fascia::num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -189,6 +189,11 @@ void Fascia::read_thread ()
         {
             safe_logger (spdlog::level::trace, "unable to read {} bytes, read {}",
                 Fascia::transaction_size, res);
+            // timeout is not a broken package
+            if (res > 0)
+            {
+                stats.add_decode_error ();
+            }
             continue;
         }
         else
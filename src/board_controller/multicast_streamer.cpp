@@ -2,28 +2,49 @@
 
 #include "board.h"
 #include "brainflow_constants.h"
-#include "file_streamer.h"
 #include "multicast_streamer.h"
 
 
-MultiCastStreamer::MultiCastStreamer (const char *ip, int port) : Streamer ()
+constexpr int MultiCastStreamer::max_package_size;
+
+
+MultiCastStreamer::MultiCastStreamer (const char *ip, int port, int batch_size) : Streamer ()
 {
     strcpy (this->ip, ip);
     this->port = port;
+    this->batch_size = batch_size;
     server = NULL;
+    send_buffer = NULL;
+    num_rows = 0;
+    num_buffered = 0;
+    sequence_num = 0;
 }
 
 MultiCastStreamer::~MultiCastStreamer ()
 {
+    if ((server != NULL) && (num_buffered > 0))
+    {
+        send_batch ();
+    }
     if (server != NULL)
     {
         delete server;
         server = NULL;
     }
+    if (send_buffer != NULL)
+    {
+        delete[] send_buffer;
+        send_buffer = NULL;
+    }
 }
 
 int MultiCastStreamer::init_streamer ()
 {
+    if (batch_size < 1)
+    {
+        Board::board_logger->error ("batch size should be positive, provided {}", batch_size);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     server = new MultiCastServer (ip, port);
     int res = server->init ();
     if (res != (int)MultiCastReturnCodes::STATUS_OK)
@@ -31,14 +52,71 @@ int MultiCastStreamer::init_streamer ()
         Board::board_logger->error ("failed to init server multicast socket {}", res);
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    send_buffer = new unsigned char[MultiCastStreamer::max_package_size];
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void MultiCastStreamer::stream_data (double *data, int len, double timestamp)
 {
-    double *send_array = new double[len + 1];
-    memcpy (send_array, data, sizeof (double) * len);
-    send_array[len] = timestamp;
-    server->send (send_array, sizeof (double) * (len + 1));
-    delete[] send_array;
+    stream_data_batch (data, len, &timestamp, 1);
+}
+
+void MultiCastStreamer::stream_data_batch (
+    double *data, int len, double *timestamps, int num_samples)
+{
+    if (num_rows != len + 1)
+    {
+        if (num_buffered > 0)
+        {
+            send_batch ();
+        }
+        num_rows = len + 1;
+    }
+    // legacy format without header
+    if (batch_size == 1)
+    {
+        for (int i = 0; i < num_samples; i++)
+        {
+            double *row = (double *)send_buffer;
+            memcpy (row, data + i * len, sizeof (double) * len);
+            row[len] = timestamps[i];
+            server->send (send_buffer, (int)sizeof (double) * num_rows);
+        }
+        return;
+    }
+    // batch size is limited by max datagram size
+    int max_samples =
+        (MultiCastStreamer::max_package_size - (int)sizeof (MultiCastPackageHeader)) /
+        ((int)sizeof (double) * num_rows);
+    if (max_samples > batch_size)
+    {
+        max_samples = batch_size;
+    }
+    for (int i = 0; i < num_samples; i++)
+    {
+        double *row = (double *)(send_buffer + sizeof (MultiCastPackageHeader)) +
+            num_buffered * num_rows;
+        memcpy (row, data + i * len, sizeof (double) * len);
+        row[len] = timestamps[i];
+        num_buffered++;
+        if (num_buffered >= max_samples)
+        {
+            send_batch ();
+        }
+    }
+}
+
+void MultiCastStreamer::send_batch ()
+{
+    MultiCastPackageHeader header;
+    header.magic = MULTICAST_PACKAGE_MAGIC;
+    header.version = MULTICAST_PACKAGE_VERSION;
+    header.num_samples = (uint16_t)num_buffered;
+    header.num_rows = (uint16_t)num_rows;
+    header.reserved = 0;
+    header.sequence_num = sequence_num++;
+    memcpy (send_buffer, &header, sizeof (header));
+    server->send (
+        send_buffer, (int)sizeof (header) + (int)sizeof (double) * num_buffered * num_rows);
+    num_buffered = 0;
 }
@@ -305,7 +305,7 @@ int BrainBit::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (BrainBit::package_size, buffer_size);
+    db = new DataBuffer (BrainBit::package_size, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -172,7 +172,7 @@ int Callibri::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (Callibri::package_size, buffer_size);
+    db = new DataBuffer (Callibri::package_size, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -8,6 +8,8 @@
 #include "board.h"
 #include "board_controller.h"
 #include "broadcast_client.h"
+#include "datagram_batch.h"
+#include "io_reactor.h"
 
 #include <oscpp/client.hpp>
 #include <oscpp/server.hpp>
@@ -20,12 +22,20 @@ private:
     volatile bool keep_alive;
     bool initialized;
     std::thread streaming_thread;
+    IOReactor *reactor; // not NULL if socket is registered in reactor instead of thread
     BroadCastClient *socket;
+    // datagrams which are already received are read at once
+    static constexpr int max_package_size = 8192;
+    static constexpr int max_batch_size = 16;
+    DatagramBatch *batch;
 
     std::mutex m;
     std::condition_variable cv;
     volatile int state;
     void read_thread ();
+    // handles received datagrams until recv fails, with reactor socket is non blocking
+    void read_packages ();
+    void on_reactor_event (bool is_hung_up);
 
     void handle_packet (const OSCPP::Server::Packet &packet);
 
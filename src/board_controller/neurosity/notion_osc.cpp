@@ -10,12 +10,16 @@
 #include <iostream>
 
 constexpr int NotionOSC::num_channels;
+constexpr int NotionOSC::max_package_size;
+constexpr int NotionOSC::max_batch_size;
 
 
 NotionOSC::NotionOSC (struct BrainFlowInputParams params)
     : Board ((int)BoardIds::NOTION_1_BOARD, params)
 {
     socket = NULL;
+    batch = NULL;
+    reactor = NULL;
     keep_alive = false;
     initialized = false;
     state = (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR;
@@ -50,6 +54,7 @@ int NotionOSC::prepare_session ()
         socket = NULL;
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    batch = new DatagramBatch (NotionOSC::max_batch_size, NotionOSC::max_package_size);
     initialized = true;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -94,7 +99,7 @@ int NotionOSC::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (NotionOSC::num_channels, buffer_size);
+    db = new DataBuffer (NotionOSC::num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -104,7 +109,19 @@ int NotionOSC::start_stream (int buffer_size, char *streamer_params)
     }
 
     keep_alive = true;
-    streaming_thread = std::thread ([this] { this->read_thread (); });
+    reactor = IOReactor::get_instance ();
+    if ((reactor != NULL) &&
+        (reactor->add (socket->get_file_descriptor (),
+             [this] (bool is_hung_up) { this->on_reactor_event (is_hung_up); }) !=
+            (int)IOReactorReturnCodes::STATUS_OK))
+    {
+        safe_logger (spdlog::level::warn, "failed to register socket in reactor, use thread");
+        reactor = NULL;
+    }
+    if (reactor == NULL)
+    {
+        streaming_thread = std::thread ([this] { this->read_thread (); });
+    }
     // wait for data to ensure that everything is okay
     std::unique_lock<std::mutex> lk (this->m);
     auto sec = std::chrono::seconds (1);
@@ -126,7 +143,16 @@ int NotionOSC::stop_stream ()
     if (keep_alive)
     {
         keep_alive = false;
-        streaming_thread.join ();
+        if (reactor != NULL)
+        {
+            // doesnt wait for socket timeout
+            reactor->remove (socket->get_file_descriptor ());
+            reactor = NULL;
+        }
+        else
+        {
+            streaming_thread.join ();
+        }
         if (streamer)
         {
             delete streamer;
@@ -156,43 +182,70 @@ int NotionOSC::release_session ()
             delete socket;
             socket = NULL;
         }
+        if (batch)
+        {
+            delete batch;
+            batch = NULL;
+        }
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void NotionOSC::read_thread ()
 {
-    int res;
-    constexpr int max_package_size = 8192;
-    unsigned char b[max_package_size];
     while (keep_alive)
     {
-        res = socket->recv (b, max_package_size);
+        read_packages ();
+    }
+}
+
+void NotionOSC::on_reactor_event (bool is_hung_up)
+{
+    read_packages ();
+    if (is_hung_up)
+    {
+        // socket is not polled anymore, board stays in streaming state until stop_stream
+        safe_logger (spdlog::level::warn,
+            "socket for port {} hung up, no more data will be received", params.ip_port);
+    }
+}
+
+void NotionOSC::read_packages ()
+{
+    while (keep_alive)
+    {
+        int res = socket->recv_batch (batch);
         if (res == -1)
         {
+            // with reactor socket is non blocking, no data is not an error
+            if (reactor == NULL)
+            {
 #ifdef _WIN32
-            safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
+                safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
 #else
-            safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
+                safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
 #endif
-            continue;
+            }
+            return;
         }
-        else
+        if (state != (int)BrainFlowExitCodes::STATUS_OK)
         {
-            if (state != (int)BrainFlowExitCodes::STATUS_OK)
+            safe_logger (spdlog::level::info,
+                "received first package with {} bytes streaming is started",
+                batch->get_datagram_size (0));
             {
-                safe_logger (spdlog::level::info,
-                    "received first package with {} bytes streaming is started", res);
-                {
-                    std::lock_guard<std::mutex> lk (m);
-                    state = (int)BrainFlowExitCodes::STATUS_OK;
-                }
-                cv.notify_one ();
-                safe_logger (spdlog::level::debug, "start streaming");
+                std::lock_guard<std::mutex> lk (m);
+                state = (int)BrainFlowExitCodes::STATUS_OK;
             }
+            cv.notify_one ();
+            safe_logger (spdlog::level::debug, "start streaming");
+        }
+        for (int i = 0; i < res; i++)
+        {
             try
             {
-                handle_packet (OSCPP::Server::Packet (b, res));
+                handle_packet (OSCPP::Server::Packet (
+                    batch->get_datagram (i), (size_t)batch->get_datagram_size (i)));
             }
             catch (...)
             {
@@ -275,6 +328,7 @@ void NotionOSC::handle_packet (const OSCPP::Server::Packet &packet)
             {
                 safe_logger (
                     spdlog::level::trace, "Exception in parsing OSC packet: {}", e.what ());
+                stats.add_decode_error ();
                 return;
             }
         }
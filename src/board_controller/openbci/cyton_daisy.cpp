@@ -1,6 +1,9 @@
+#include <string.h>
+
 #include "cyton_daisy.h"
 #include "custom_cast.h"
 #include "serial.h"
+#include "serial_packet_reader.h"
 #include "timestamp.h"
 
 #define START_BYTE 0xA0
@@ -9,7 +12,18 @@
 #define END_BYTE_MAX 0xC6
 
 
-void CytonDaisy::read_thread ()
+int CytonDaisy::start_stream (int buffer_size, char *streamer_params)
+{
+    // stream can start from daisy package, dont join it with package from previous session
+    if (!is_streaming)
+    {
+        memset (package, 0, sizeof (package));
+        memset (accel, 0, sizeof (accel));
+    }
+    return OpenBCISerialBoard::start_stream (buffer_size, streamer_params);
+}
+
+void CytonDaisy::read_packages ()
 {
     // format is the same as for cyton but need to join two packages together
     /*
@@ -26,43 +40,26 @@ void CytonDaisy::read_thread ()
         Aux Data Bytes 27-32: 6 bytes of data
         Byte 33: 0xCX where X is 0-F in hex
     */
-    int res;
-    unsigned char b[32];
-    double package[30] = {0.};
     bool first_sample = true;
-    double accel[3] = {0.};
     while (keep_alive)
     {
-        // check start byte
-        res = serial->read_from_serial_port (b, 1);
-        if (res != 1)
-        {
-            safe_logger (spdlog::level::debug, "unable to read 1 byte");
-            continue;
-        }
-        if (b[0] != START_BYTE)
-        {
-            continue;
-        }
-
-        int remaining_bytes = 32;
-        int pos = 0;
-        while ((remaining_bytes > 0) && (keep_alive))
-        {
-            res = serial->read_from_serial_port (b + pos, remaining_bytes);
-            remaining_bytes -= res;
-            pos += res;
-        }
-        if (!keep_alive)
+        const unsigned char *package_bytes = NULL;
+        if (reader->peek_packet (START_BYTE, 33, &package_bytes) != 33)
         {
             return;
         }
-
+        // skip start byte
+        const unsigned char *b = package_bytes + 1;
         if ((b[31] < END_BYTE_STANDARD) || (b[31] > END_BYTE_MAX))
         {
             safe_logger (spdlog::level::warn, "Wrong end byte {}", b[31]);
+            stats.add_decode_error ();
+            // start byte was wrong, search for the next one
+            reader->consume (1);
             continue;
         }
+        // bytes stay in buffer until the next read
+        reader->consume (33);
 
         // For Cyton Daisy Serial, sample IDs are sequenctial
         // (0, 1, 2, 3...) so even sample IDs are the first sample (daisy)
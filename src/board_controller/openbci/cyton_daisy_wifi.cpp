@@ -1,12 +1,9 @@
+#include <string.h>
+
 #include "cyton_daisy_wifi.h"
 #include "custom_cast.h"
 #include "timestamp.h"
 
-#ifndef _WIN32
-#include <errno.h>
-#endif
-
-#define START_BYTE 0xA0
 #define END_BYTE_STANDARD 0xC0
 #define END_BYTE_ANALOG 0xC1
 #define END_BYTE_MAX 0xC6
@@ -23,7 +20,20 @@ int CytonDaisyWifi::prepare_session ()
     return send_config ("d");
 }
 
-void CytonDaisyWifi::read_thread ()
+int CytonDaisyWifi::start_stream (int buffer_size, char *streamer_params)
+{
+    // stream can start from daisy package, dont join it with package from previous session
+    if (!keep_alive)
+    {
+        memset (package, 0, sizeof (package));
+        memset (accel, 0, sizeof (accel));
+        first_sample = true;
+        last_sample_id = 0;
+    }
+    return OpenBCIWifiShieldBoard::start_stream (buffer_size, streamer_params);
+}
+
+void CytonDaisyWifi::read_packages ()
 {
     // format is the same as for cyton but need to join two packages together
     /*
@@ -40,41 +50,16 @@ void CytonDaisyWifi::read_thread ()
         Aux Data Bytes 27-32: 6 bytes of data
         Byte 33: 0xCX where X is 0-F in hex
     */
-    int res;
-    unsigned char b[OpenBCIWifiShieldBoard::package_size];
-    double package[30] = {0.};
-    bool first_sample = true;
-    double accel[3] = {0.};
-    unsigned char last_sample_id = 0;
     while (keep_alive)
     {
-        res = server_socket->recv (b, OpenBCIWifiShieldBoard::package_size);
-        if (res != OpenBCIWifiShieldBoard::package_size)
-        {
-            if (res < 0)
-            {
-#ifdef _WIN32
-                safe_logger (spdlog::level::warn, "WSAGetLastError is {}", WSAGetLastError ());
-#else
-                safe_logger (spdlog::level::warn, "errno {} message {}", errno, strerror (errno));
-#endif
-            }
-
-            continue;
-        }
-
-        if (b[0] != START_BYTE)
-        {
-            continue;
-        }
-        unsigned char *bytes = b + 1; // for better consistency between plain cyton and wifi, in
-                                      // plain cyton index is shifted by 1
-
-        if ((bytes[31] < END_BYTE_STANDARD) || (bytes[31] > END_BYTE_MAX))
+        // start and end bytes are checked in read_package
+        const unsigned char *b = read_package ();
+        if (b == NULL)
         {
-            safe_logger (spdlog::level::warn, "Wrong end byte {}", bytes[31]);
-            continue;
+            return;
         }
+        const unsigned char *bytes = b + 1; // for better consistency between plain cyton and
+                                            // wifi, in plain cyton index is shifted by 1
 
 
         // For Cyton Daisy Wifi, sample IDs are repeated twice
@@ -193,9 +178,7 @@ void CytonDaisyWifi::read_thread ()
         // commit package
         if (!first_sample)
         {
-            double timestamp = get_timestamp ();
-            db->add_data (timestamp, package);
-            streamer->stream_data (package, 30, timestamp);
+            add_package (package, get_timestamp ());
         }
 
         first_sample = false;
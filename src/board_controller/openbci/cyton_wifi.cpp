@@ -1,13 +1,10 @@
+#include <string.h>
+
 #include "cyton_wifi.h"
 #include "custom_cast.h"
 #include "timestamp.h"
 
-#ifndef _WIN32
-#include <errno.h>
-#endif
-
 
-#define START_BYTE 0xA0
 #define END_BYTE_STANDARD 0xC0
 #define END_BYTE_ANALOG 0xC1
 #define END_BYTE_MAX 0xC6
@@ -24,7 +21,17 @@ int CytonWifi::prepare_session ()
     return send_config ("d");
 }
 
-void CytonWifi::read_thread ()
+int CytonWifi::start_stream (int buffer_size, char *streamer_params)
+{
+    // dont use accel values from previous session
+    if (!keep_alive)
+    {
+        memset (accel, 0, sizeof (accel));
+    }
+    return OpenBCIWifiShieldBoard::start_stream (buffer_size, streamer_params);
+}
+
+void CytonWifi::read_packages ()
 {
     /*
         Byte 1: 0xA0
@@ -40,39 +47,16 @@ void CytonWifi::read_thread ()
         Aux Data Bytes 27-32: 6 bytes of data
         Byte 33: 0xCX where X is 0-F in hex
     */
-    int res;
-    unsigned char b[OpenBCIWifiShieldBoard::package_size];
-    double accel[3] = {0.};
     while (keep_alive)
     {
-        // check start byte
-        res = server_socket->recv (b, OpenBCIWifiShieldBoard::package_size);
-        if (res != OpenBCIWifiShieldBoard::package_size)
-        {
-            if (res < 0)
-            {
-#ifdef _WIN32
-                safe_logger (spdlog::level::warn, "WSAGetLastError is {}", WSAGetLastError ());
-#else
-                safe_logger (spdlog::level::warn, "errno {} message {}", errno, strerror (errno));
-#endif
-            }
-
-            continue;
-        }
-
-        if (b[0] != START_BYTE)
-        {
-            continue;
-        }
-        unsigned char *bytes = b + 1; // for better consistency between plain cyton and wifi, in
-                                      // plain cyton index is shifted by 1
-
-        if ((bytes[31] < END_BYTE_STANDARD) || (bytes[31] > END_BYTE_MAX))
+        // start and end bytes are checked in read_package
+        const unsigned char *b = read_package ();
+        if (b == NULL)
         {
-            safe_logger (spdlog::level::warn, "Wrong end byte {}", bytes[31]);
-            continue;
+            return;
         }
+        const unsigned char *bytes = b + 1; // for better consistency between plain cyton and
+                                            // wifi, in plain cyton index is shifted by 1
 
         double package[22] = {0.};
         // package num
@@ -117,8 +101,6 @@ void CytonWifi::read_thread ()
             package[21] = cast_16bit_to_int32 (bytes + 29);
         }
 
-        double timestamp = get_timestamp ();
-        db->add_data (timestamp, package);
-        streamer->stream_data (package, 22, timestamp);
+        add_package (package, get_timestamp ());
     }
 }
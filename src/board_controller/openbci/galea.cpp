@@ -19,6 +19,8 @@ constexpr int Galea::transaction_size;
 Galea::Galea (struct BrainFlowInputParams params) : Board ((int)BoardIds::GALEA_BOARD, params)
 {
     this->socket = NULL;
+    this->batch = NULL;
+    this->reactor = NULL;
     this->is_streaming = false;
     this->keep_alive = false;
     this->initialized = false;
@@ -78,6 +80,7 @@ int Galea::prepare_session ()
         socket = NULL;
         return (int)BrainFlowExitCodes::BOARD_WRITE_ERROR;
     }
+    batch = new DatagramBatch (Galea::max_batch_size, Galea::transaction_size);
     initialized = true;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -189,7 +192,7 @@ int Galea::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (Galea::num_channels, buffer_size);
+    db = new DataBuffer (Galea::num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -215,7 +218,19 @@ int Galea::start_stream (int buffer_size, char *streamer_params)
     }
 
     keep_alive = true;
-    streaming_thread = std::thread ([this] { this->read_thread (); });
+    reactor = IOReactor::get_instance ();
+    if ((reactor != NULL) &&
+        (reactor->add (socket->get_file_descriptor (),
+             [this] (bool is_hung_up) { this->on_reactor_event (is_hung_up); }) !=
+            (int)IOReactorReturnCodes::STATUS_OK))
+    {
+        safe_logger (spdlog::level::warn, "failed to register socket in reactor, use thread");
+        reactor = NULL;
+    }
+    if (reactor == NULL)
+    {
+        streaming_thread = std::thread ([this] { this->read_thread (); });
+    }
     // wait for data to ensure that everything is okay
     std::unique_lock<std::mutex> lk (this->m);
     auto sec = std::chrono::seconds (1);
@@ -240,7 +255,16 @@ int Galea::stop_stream ()
     {
         keep_alive = false;
         is_streaming = false;
-        streaming_thread.join ();
+        if (reactor != NULL)
+        {
+            // doesnt wait for socket timeout, socket is blocking again after remove
+            reactor->remove (socket->get_file_descriptor ());
+            reactor = NULL;
+        }
+        else
+        {
+            streaming_thread.join ();
+        }
         if (streamer)
         {
             delete streamer;
@@ -305,44 +329,82 @@ int Galea::release_session ()
             delete socket;
             socket = NULL;
         }
+        if (batch)
+        {
+            delete batch;
+            batch = NULL;
+        }
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void Galea::read_thread ()
 {
-    int res;
-    unsigned char b[Galea::transaction_size];
-    constexpr int offset_last_package = Galea::package_size * (Galea::num_packages - 1);
-    for (int i = 0; i < Galea::transaction_size; i++)
+    while (keep_alive)
+    {
+        read_packages ();
+    }
+}
+
+void Galea::on_reactor_event (bool is_hung_up)
+{
+    read_packages ();
+    if (is_hung_up)
     {
-        b[i] = 0;
+        // socket is not polled anymore, board stays in streaming state until stop_stream
+        safe_logger (spdlog::level::warn, "socket for {} hung up, no more data will be received",
+            params.ip_address.c_str ());
     }
+}
+
+void Galea::read_packages ()
+{
     while (keep_alive)
     {
-        res = socket->recv (b, Galea::transaction_size);
+        int res = socket->recv_batch (batch);
         double recv_time = get_timestamp ();
         if (res == -1)
         {
+            // with reactor socket is non blocking, no data is not an error
+            if (reactor == NULL)
+            {
 #ifdef _WIN32
-            safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
+                safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
 #else
-            safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
+                safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
 #endif
+            }
+            return;
         }
-        if (res != Galea::transaction_size)
+        // recv_time is the time of the last package in the last transaction, timestamps of
+        // packages from previous transactions are shifted by device time
+        double timestamp_device_last = 0.0;
+        for (int i = res - 1; i >= 0; i--)
         {
-            safe_logger (spdlog::level::trace, "unable to read {} bytes, read {}",
-                Galea::transaction_size, res);
-            continue;
+            if (batch->get_datagram_size (i) == Galea::transaction_size)
+            {
+                memcpy (&timestamp_device_last,
+                    batch->get_datagram (i) + 64 + Galea::package_size * (Galea::num_packages - 1),
+                    8);
+                timestamp_device_last /= 1e6; // convert usec to sec
+                break;
+            }
         }
-        else
+        for (int i = 0; i < res; i++)
         {
+            int size = batch->get_datagram_size (i);
+            if (size != Galea::transaction_size)
+            {
+                safe_logger (spdlog::level::trace, "unable to read {} bytes, read {}",
+                    Galea::transaction_size, size);
+                stats.add_decode_error ();
+                continue;
+            }
             // inform main thread that everything is ok and first package was received
             if (this->state != (int)BrainFlowExitCodes::STATUS_OK)
             {
                 safe_logger (spdlog::level::info,
-                    "received first package with {} bytes streaming is started", res);
+                    "received first package with {} bytes streaming is started", size);
                 {
                     std::lock_guard<std::mutex> lk (this->m);
                     this->state = (int)BrainFlowExitCodes::STATUS_OK;
@@ -350,59 +412,66 @@ void Galea::read_thread ()
                 this->cv.notify_one ();
                 safe_logger (spdlog::level::debug, "start streaming");
             }
+            add_transaction (batch->get_datagram (i), recv_time, timestamp_device_last);
         }
+    }
+}
 
-        for (int cur_package = 0; cur_package < Galea::num_packages; cur_package++)
+void Galea::add_transaction (const unsigned char *b, double recv_time, double timestamp_device_last)
+{
+    // all packages from transaction are added to the buffer at once
+    double packages[Galea::num_packages * Galea::num_channels];
+    double timestamps[Galea::num_packages];
+    for (int cur_package = 0; cur_package < Galea::num_packages; cur_package++)
+    {
+        double *package = packages + cur_package * Galea::num_channels;
+        for (int i = 0; i < Galea::num_channels; i++)
         {
-            double package[Galea::num_channels] = {0.};
-            int offset = cur_package * package_size;
-            // package num
-            package[0] = (double)b[0 + offset];
-            // eeg and emg
-            for (int i = 4, tmp_counter = 0; i < 20; i++, tmp_counter++)
-            {
-                // put them directly after package num in brainflow
-                if (tmp_counter < 8)
-                    package[i - 3] = eeg_scale_main_board *
-                        (double)cast_24bit_to_int32 (b + offset + 5 + 3 * (i - 4));
-                else if ((tmp_counter == 9) || (tmp_counter == 14))
-                    package[i - 3] = eeg_scale_sister_board *
-                        (double)cast_24bit_to_int32 (b + offset + 5 + 3 * (i - 4));
-                else
-                    package[i - 3] =
-                        emg_scale * (double)cast_24bit_to_int32 (b + offset + 5 + 3 * (i - 4));
-            }
-            uint16_t temperature;
-            int32_t ppg_ir;
-            int32_t ppg_red;
-            float eda;
-            memcpy (&temperature, b + 54 + offset, 2);
-            memcpy (&eda, b + 1 + offset, 4);
-            memcpy (&ppg_red, b + 56 + offset, 4);
-            memcpy (&ppg_ir, b + 60 + offset, 4);
-            // ppg
-            package[17] = (double)ppg_red;
-            package[18] = (double)ppg_ir;
-            // eda
-            package[19] = (double)eda;
-            // temperature
-            package[20] = temperature / 100.0;
-            // battery
-            package[21] = (double)b[53 + offset];
-
-            double timestamp_device_cur;
-            memcpy (&timestamp_device_cur, b + 64 + offset, 8);
-            double timestamp_device_last;
-            memcpy (&timestamp_device_last, b + 64 + offset_last_package, 8);
-            timestamp_device_cur /= 1e6; // convert usec to sec
-            timestamp_device_last /= 1e6;
-            double time_delta = timestamp_device_last - timestamp_device_cur;
+            package[i] = 0.0;
+        }
+        int offset = cur_package * package_size;
+        // package num
+        package[0] = (double)b[0 + offset];
+        // eeg and emg
+        for (int i = 4, tmp_counter = 0; i < 20; i++, tmp_counter++)
+        {
+            // put them directly after package num in brainflow
+            if (tmp_counter < 8)
+                package[i - 3] = eeg_scale_main_board *
+                    (double)cast_24bit_to_int32 (b + offset + 5 + 3 * (i - 4));
+            else if ((tmp_counter == 9) || (tmp_counter == 14))
+                package[i - 3] = eeg_scale_sister_board *
+                    (double)cast_24bit_to_int32 (b + offset + 5 + 3 * (i - 4));
+            else
+                package[i - 3] =
+                    emg_scale * (double)cast_24bit_to_int32 (b + offset + 5 + 3 * (i - 4));
+        }
+        uint16_t temperature;
+        int32_t ppg_ir;
+        int32_t ppg_red;
+        float eda;
+        memcpy (&temperature, b + 54 + offset, 2);
+        memcpy (&eda, b + 1 + offset, 4);
+        memcpy (&ppg_red, b + 56 + offset, 4);
+        memcpy (&ppg_ir, b + 60 + offset, 4);
+        // ppg
+        package[17] = (double)ppg_red;
+        package[18] = (double)ppg_ir;
+        // eda
+        package[19] = (double)eda;
+        // temperature
+        package[20] = temperature / 100.0;
+        // battery
+        package[21] = (double)b[53 + offset];
 
-            // workaround micros() overflow issue in firmware
-            double timestamp = (time_delta < 0) ? get_timestamp () : recv_time - time_delta;
+        double timestamp_device_cur;
+        memcpy (&timestamp_device_cur, b + 64 + offset, 8);
+        timestamp_device_cur /= 1e6; // convert usec to sec
+        double time_delta = timestamp_device_last - timestamp_device_cur;
 
-            streamer->stream_data (package, Galea::num_channels, timestamp);
-            db->add_data (timestamp, package);
-        }
+        // workaround micros() overflow issue in firmware
+        timestamps[cur_package] = (time_delta < 0) ? get_timestamp () : recv_time - time_delta;
     }
+    streamer->stream_data_batch (packages, Galea::num_channels, timestamps, Galea::num_packages);
+    db->add_data_batch (timestamps, packages, Galea::num_packages);
 }
@@ -34,6 +34,8 @@ Ganglion::Ganglion (struct BrainFlowInputParams params)
     keep_alive = false;
     initialized = false;
     num_channels = 13;
+    // compressed package contains two samples
+    samples_per_package_num = 2;
     state = (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR;
     start_command = "b";
     stop_command = "s";
@@ -164,7 +166,7 @@ int Ganglion::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (num_channels, buffer_size);
+    db = new DataBuffer (num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         Board::board_logger->error ("unable to prepare buffer with size {}", buffer_size);
@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "ganglion_wifi.h"
 #include "custom_cast.h"
 #include "timestamp.h"
@@ -69,7 +71,7 @@ int GanglionWifi::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (num_channels, buffer_size);
+    db = new DataBuffer (num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -111,8 +113,8 @@ int GanglionWifi::start_stream (int buffer_size, char *streamer_params)
         }
         http_release (request);
 
-        keep_alive = true;
-        streaming_thread = std::thread ([this] { this->read_thread (); });
+        memset (package, 0, sizeof (package));
+        start_reading ();
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
@@ -122,8 +124,7 @@ int GanglionWifi::stop_stream ()
 {
     if (keep_alive)
     {
-        keep_alive = false;
-        streaming_thread.join ();
+        stop_reading ();
         if (streamer)
         {
             delete streamer;
@@ -158,7 +159,7 @@ int GanglionWifi::stop_stream ()
     }
 }
 
-void GanglionWifi::read_thread ()
+void GanglionWifi::read_packages ()
 {
     /*  Only for Ganglion + WIFI shield, plain Ganglion has another format
         Byte 1: 0xA0
@@ -171,39 +172,13 @@ void GanglionWifi::read_thread ()
         Aux Data Bytes 27-32: 6 bytes of data
         Byte 33: 0xCX where X is 0-F in hex
     */
-    int res;
-    unsigned char b[OpenBCIWifiShieldBoard::package_size];
-    double *package = new double[num_channels];
-    for (int i = 0; i < num_channels; i++)
-    {
-        package[i] = 0.0;
-    }
     while (keep_alive)
     {
-        // check start byte
-        res = server_socket->recv (b, OpenBCIWifiShieldBoard::package_size);
-        if (res != OpenBCIWifiShieldBoard::package_size)
+        // start and end bytes are checked in read_package
+        const unsigned char *b = read_package ();
+        if (b == NULL)
         {
-            if (res < 0)
-            {
-#ifdef _WIN32
-                safe_logger (spdlog::level::warn, "WSAGetLastError is {}", WSAGetLastError ());
-#else
-                safe_logger (spdlog::level::warn, "errno {} message {}", errno, strerror (errno));
-#endif
-            }
-
-            continue;
-        }
-
-        if (b[0] != START_BYTE)
-        {
-            continue;
-        }
-        if ((b[32] < END_BYTE_STANDARD) || (b[32] > END_BYTE_MAX))
-        {
-            safe_logger (spdlog::level::warn, "Wrong end byte, found {}", b[32]);
-            continue;
+            return;
         }
 
         // package num
@@ -240,21 +215,18 @@ void GanglionWifi::read_thread ()
             package[17] = cast_16bit_to_int32 (b + 30);
         }
 
-        double timestamp = get_timestamp ();
-        db->add_data (timestamp, package);
-        streamer->stream_data (package, num_channels, timestamp);
+        add_package (package, get_timestamp ());
     }
-    delete[] package;
 }
 
 void GanglionWifi::read_thread_impedance ()
 {
     int res;
     unsigned char b[OpenBCIWifiShieldBoard::package_size];
-    double *package = new double[num_channels];
+    double *impedance_package = new double[num_channels];
     for (int i = 0; i < num_channels; i++)
     {
-        package[i] = 0.0;
+        impedance_package[i] = 0.0;
     }
     while (keep_alive)
     {
@@ -311,11 +283,11 @@ void GanglionWifi::read_thread_impedance ()
             safe_logger (spdlog::level::warn, "channel number is {}", channel_num);
             continue;
         }
-        package[18 + channel_num - 1] = val;
+        impedance_package[18 + channel_num - 1] = val;
 
         double timestamp = get_timestamp ();
-        db->add_data (timestamp, package);
-        streamer->stream_data (package, num_channels, timestamp);
+        db->add_data (timestamp, impedance_package);
+        streamer->stream_data (impedance_package, num_channels, timestamp);
     }
-    delete[] package;
+    delete[] impedance_package;
 }
@@ -11,13 +11,18 @@ class CytonDaisy : public OpenBCISerialBoard
 {
     float eeg_scale = ADS1299_Vref / float((pow (2, 23) - 1)) / ADS1299_gain * 1000000.;
     float accel_scale = 0.002 / (pow (2, 4));
+    // daisy and cyton packages are joined together
+    double package[30] = {0.};
+    double accel[3] = {0.};
 
 protected:
-    void read_thread ();
+    void read_packages ();
 
 public:
     CytonDaisy (struct BrainFlowInputParams params)
         : OpenBCISerialBoard (30, params, (int)BoardIds::CYTON_DAISY_BOARD)
     {
     }
+
+    int start_stream (int buffer_size, char *streamer_params);
 };
@@ -11,9 +11,14 @@ class CytonDaisyWifi : public OpenBCIWifiShieldBoard
 {
     float eeg_scale = ADS1299_Vref / float((pow (2, 23) - 1)) / ADS1299_gain * 1000000.;
     float accel_scale = 0.002 / (pow (2, 4));
+    // daisy and cyton packages are joined together
+    double package[30] = {0.};
+    double accel[3] = {0.};
+    bool first_sample = true;
+    unsigned char last_sample_id = 0;
 
 protected:
-    void read_thread ();
+    void read_packages ();
 
 public:
     // package num, 16 eeg channels, 3 accel channels
@@ -23,4 +28,5 @@ public:
     }
 
     int prepare_session ();
+    int start_stream (int buffer_size, char *streamer_params);
 };
@@ -11,9 +11,10 @@ class CytonWifi : public OpenBCIWifiShieldBoard
 {
     float eeg_scale = ADS1299_Vref / float((pow (2, 23) - 1)) / ADS1299_gain * 1000000.;
     float accel_scale = 0.002 / (pow (2, 4));
+    double accel[3] = {0.};
 
 protected:
-    void read_thread ();
+    void read_packages ();
 
 public:
     // package num, 8 eeg channels, 3 accel channels
@@ -23,4 +24,5 @@ public:
     }
 
     int prepare_session ();
+    int start_stream (int buffer_size, char *streamer_params);
 };
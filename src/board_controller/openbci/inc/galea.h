@@ -7,6 +7,8 @@
 
 #include "board.h"
 #include "board_controller.h"
+#include "datagram_batch.h"
+#include "io_reactor.h"
 #include "socket_client_udp.h"
 
 #define ADS1299_Vref 4.5
@@ -26,12 +28,20 @@ private:
     bool initialized;
     bool is_streaming;
     std::thread streaming_thread;
+    IOReactor *reactor; // not NULL if socket is registered in reactor instead of thread
     SocketClientUDP *socket;
+    // datagrams which are already received are read at once
+    DatagramBatch *batch;
 
     std::mutex m;
     std::condition_variable cv;
     volatile int state;
     void read_thread ();
+    // handles received transactions until recv fails, with reactor socket is non blocking
+    void read_packages ();
+    void on_reactor_event (bool is_hung_up);
+    // parses packages from a transaction, recv_time corresponds to timestamp_device_last
+    void add_transaction (const unsigned char *b, double recv_time, double timestamp_device_last);
 
 public:
     Galea (struct BrainFlowInputParams params);
@@ -47,4 +57,6 @@ public:
     static constexpr int package_size = 72;
     static constexpr int num_packages = 19;
     static constexpr int transaction_size = package_size * num_packages;
+    // max number of transactions received by one syscall
+    static constexpr int max_batch_size = 16;
 };
@@ -13,9 +13,10 @@ class GanglionWifi : public OpenBCIWifiShieldBoard
     float const eeg_scale = (1.2f * 1000000) / (8388607.0f * 1.5f * 51.0f);
 
     volatile bool is_cheking_impedance;
+    double package[23] = {0.};
 
 protected:
-    void read_thread ();
+    void read_packages ();
     void read_thread_impedance ();
 
 public:
@@ -4,7 +4,9 @@
 
 #include "board.h"
 #include "board_controller.h"
+#include "io_reactor.h"
 #include "serial.h"
+#include "serial_packet_reader.h"
 
 
 class OpenBCISerialBoard : public Board
@@ -15,14 +17,20 @@ protected:
     bool initialized;
     bool is_streaming;
     std::thread streaming_thread;
+    IOReactor *reactor; // not NULL if port is registered in reactor instead of thread
 
     Serial *serial;
+    SerialPacketReader *reader;
     int num_channels;
 
     virtual int open_port ();
     virtual int status_check ();
     virtual int set_port_settings ();
-    virtual void read_thread () = 0;
+    void read_thread ();
+    // handles packages from reader until there is no complete package, called in a loop by
+    // streaming thread or by reactor when port has data
+    virtual void read_packages () = 0;
+    void on_reactor_event (bool is_hung_up);
     virtual int send_to_board (const char *msg);
 
 public:
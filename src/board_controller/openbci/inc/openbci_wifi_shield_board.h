@@ -2,9 +2,11 @@
 
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "board.h"
 #include "board_controller.h"
+#include "io_reactor.h"
 #include "socket_server_tcp.h"
 
 
@@ -20,13 +22,34 @@ protected:
     volatile bool keep_alive;
     bool initialized;
     std::thread streaming_thread;
+    IOReactor *reactor; // not NULL if socket is registered in reactor instead of thread
 
     SocketServerTCP *server_socket;
     int num_channels;
 
+    // packages which are received together are added to buffer and streamer at once
+    std::vector<double> batch_packages;
+    std::vector<double> batch_timestamps;
+    int batch_len;
+
     std::string find_wifi_shield ();
+    // waits for the next package with valid start and end bytes and removes it from socket
+    // buffer, returns NULL if it's not received yet(with reactor doesnt wait). Package is valid
+    // until the next call
+    const unsigned char *read_package ();
+    // copies package with num_channels values to batch, batch is flushed if it's full
+    void add_package (double *package, double timestamp);
+    // called before waiting for new data from socket
+    void flush_packages ();
 
-    virtual void read_thread () = 0;
+    // registers socket in reactor or starts streaming thread, and stops them
+    void start_reading ();
+    void stop_reading ();
+    void read_thread ();
+    void on_reactor_event (bool is_hung_up);
+    // handles packages from socket until there is no complete package, called in a loop by
+    // streaming thread or by reactor when socket has data
+    virtual void read_packages () = 0;
     virtual int send_config (const char *config);
 
 public:
@@ -40,4 +63,5 @@ public:
     virtual int config_board (std::string config, std::string &response);
 
     static constexpr int package_size = 33;
+    static constexpr int max_batch_size = 32;
 };
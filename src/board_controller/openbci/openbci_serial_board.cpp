@@ -9,6 +9,8 @@ OpenBCISerialBoard::OpenBCISerialBoard (
 {
     this->num_channels = num_channels;
     serial = NULL;
+    reader = NULL;
+    reactor = NULL;
     is_streaming = false;
     keep_alive = false;
     initialized = false;
@@ -218,7 +220,7 @@ int OpenBCISerialBoard::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (num_channels, buffer_size);
+    db = new DataBuffer (num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -234,7 +236,20 @@ int OpenBCISerialBoard::start_stream (int buffer_size, char *streamer_params)
         return send_res;
     }
     keep_alive = true;
-    streaming_thread = std::thread ([this] { this->read_thread (); });
+    reader = new SerialPacketReader (serial);
+    reactor = IOReactor::get_instance ();
+    if ((reactor != NULL) &&
+        (reactor->add (serial->get_file_descriptor (),
+             [this] (bool is_hung_up) { this->on_reactor_event (is_hung_up); }) !=
+            (int)IOReactorReturnCodes::STATUS_OK))
+    {
+        safe_logger (spdlog::level::warn, "failed to register port in reactor, use thread");
+        reactor = NULL;
+    }
+    if (reactor == NULL)
+    {
+        streaming_thread = std::thread ([this] { this->read_thread (); });
+    }
     is_streaming = true;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -245,10 +260,18 @@ int OpenBCISerialBoard::stop_stream ()
     {
         keep_alive = false;
         is_streaming = false;
-        if (streaming_thread.joinable ())
+        if (reactor != NULL)
+        {
+            // doesnt wait for port timeout
+            reactor->remove (serial->get_file_descriptor ());
+            reactor = NULL;
+        }
+        else if (streaming_thread.joinable ())
         {
             streaming_thread.join ();
         }
+        delete reader;
+        reader = NULL;
         if (streamer)
         {
             delete streamer;
@@ -262,6 +285,25 @@ int OpenBCISerialBoard::stop_stream ()
     }
 }
 
+void OpenBCISerialBoard::on_reactor_event (bool is_hung_up)
+{
+    read_packages ();
+    if (is_hung_up)
+    {
+        // port is not polled anymore, board stays in streaming state until stop_stream
+        safe_logger (spdlog::level::warn, "serial port {} hung up, no more data will be received",
+            params.serial_port.c_str ());
+    }
+}
+
+void OpenBCISerialBoard::read_thread ()
+{
+    while (keep_alive)
+    {
+        read_packages ();
+    }
+}
+
 int OpenBCISerialBoard::release_session ()
 {
     if (initialized)
@@ -6,6 +6,10 @@
 #include "openbci_wifi_shield_board.h"
 #include "socket_client_udp.h"
 
+#ifndef _WIN32
+#include <errno.h>
+#endif
+
 #include "json.hpp"
 
 #define HTTP_IMPLEMENTATION
@@ -13,14 +17,23 @@
 
 using json = nlohmann::json;
 
+#define START_BYTE 0xA0
+#define END_BYTE_STANDARD 0xC0
+#define END_BYTE_MAX 0xC6
+
 constexpr int OpenBCIWifiShieldBoard::package_size;
+constexpr int OpenBCIWifiShieldBoard::max_batch_size;
 
 OpenBCIWifiShieldBoard::OpenBCIWifiShieldBoard (
     int num_channels, struct BrainFlowInputParams params, int board_id)
-    : Board (board_id, params)
+    : Board (board_id, params),
+      batch_packages (max_batch_size * num_channels),
+      batch_timestamps (max_batch_size)
 {
     this->num_channels = num_channels;
+    batch_len = 0;
     server_socket = NULL;
+    reactor = NULL;
     keep_alive = false;
     initialized = false;
     http_timeout = 10;
@@ -219,6 +232,71 @@ int OpenBCIWifiShieldBoard::send_config (const char *config)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+const unsigned char *OpenBCIWifiShieldBoard::read_package ()
+{
+    while (true)
+    {
+        // socket call below blocks if there is no complete package in buffer
+        if (server_socket->get_num_buffered () < package_size)
+        {
+            flush_packages ();
+        }
+        const unsigned char *package = NULL;
+        int res = server_socket->peek_packet (START_BYTE, package_size, &package);
+        if (res != package_size)
+        {
+            // with reactor socket is non blocking, no data is not an error
+            if ((res < 0) && (reactor == NULL))
+            {
+#ifdef _WIN32
+                safe_logger (spdlog::level::warn, "WSAGetLastError is {}", WSAGetLastError ());
+#else
+                safe_logger (
+                    spdlog::level::warn, "errno {} message {}", errno, strerror (errno));
+#endif
+            }
+            flush_packages ();
+            return NULL;
+        }
+        if ((package[package_size - 1] < END_BYTE_STANDARD) ||
+            (package[package_size - 1] > END_BYTE_MAX))
+        {
+            safe_logger (spdlog::level::warn, "Wrong end byte {}", package[package_size - 1]);
+            stats.add_decode_error ();
+            // start byte was wrong, search for the next one
+            server_socket->consume (1);
+            continue;
+        }
+        // bytes stay in buffer until the next socket call
+        server_socket->consume (package_size);
+        return package;
+    }
+}
+
+void OpenBCIWifiShieldBoard::add_package (double *package, double timestamp)
+{
+    memcpy (batch_packages.data () + batch_len * num_channels, package,
+        sizeof (double) * num_channels);
+    batch_timestamps[batch_len] = timestamp;
+    batch_len++;
+    if (batch_len == max_batch_size)
+    {
+        flush_packages ();
+    }
+}
+
+void OpenBCIWifiShieldBoard::flush_packages ()
+{
+    if (batch_len == 0)
+    {
+        return;
+    }
+    streamer->stream_data_batch (
+        batch_packages.data (), num_channels, batch_timestamps.data (), batch_len);
+    db->add_data_batch (batch_timestamps.data (), batch_packages.data (), batch_len);
+    batch_len = 0;
+}
+
 int OpenBCIWifiShieldBoard::config_board (std::string config, std::string &response)
 {
     return send_config (config.c_str ());
@@ -253,7 +331,7 @@ int OpenBCIWifiShieldBoard::start_stream (int buffer_size, char *streamer_params
     {
         return res;
     }
-    db = new DataBuffer (num_channels, buffer_size);
+    db = new DataBuffer (num_channels, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
@@ -277,8 +355,7 @@ int OpenBCIWifiShieldBoard::start_stream (int buffer_size, char *streamer_params
     }
     http_release (request);
 
-    keep_alive = true;
-    streaming_thread = std::thread ([this] { this->read_thread (); });
+    start_reading ();
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -286,8 +363,7 @@ int OpenBCIWifiShieldBoard::stop_stream ()
 {
     if (keep_alive)
     {
-        keep_alive = false;
-        streaming_thread.join ();
+        stop_reading ();
         if (streamer)
         {
             delete streamer;
@@ -440,3 +516,60 @@ int OpenBCIWifiShieldBoard::wait_for_http_resp (http_t *request)
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
+
+void OpenBCIWifiShieldBoard::start_reading ()
+{
+    keep_alive = true;
+    batch_len = 0;
+    reactor = IOReactor::get_instance ();
+    if ((reactor != NULL) &&
+        (reactor->add (server_socket->get_file_descriptor (),
+             [this] (bool is_hung_up) { this->on_reactor_event (is_hung_up); }) !=
+            (int)IOReactorReturnCodes::STATUS_OK))
+    {
+        safe_logger (spdlog::level::warn, "failed to register socket in reactor, use thread");
+        reactor = NULL;
+    }
+    if (reactor == NULL)
+    {
+        streaming_thread = std::thread ([this] {
+            this->read_thread ();
+            this->flush_packages ();
+        });
+    }
+}
+
+void OpenBCIWifiShieldBoard::stop_reading ()
+{
+    keep_alive = false;
+    if (reactor != NULL)
+    {
+        // doesnt wait for socket timeout, packages are flushed by handler
+        reactor->remove (server_socket->get_file_descriptor ());
+        reactor = NULL;
+    }
+    else if (streaming_thread.joinable ())
+    {
+        streaming_thread.join ();
+    }
+}
+
+void OpenBCIWifiShieldBoard::read_thread ()
+{
+    while (keep_alive)
+    {
+        read_packages ();
+    }
+}
+
+void OpenBCIWifiShieldBoard::on_reactor_event (bool is_hung_up)
+{
+    read_packages ();
+    if (is_hung_up)
+    {
+        // socket is not polled anymore, board stays in streaming state until stop_stream
+        safe_logger (spdlog::level::warn, "connection with wifi shield {} hung up, no more data "
+                                          "will be received",
+            params.ip_address.c_str ());
+    }
+}
@@ -113,7 +113,8 @@ int PlaybackFileBoard::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (package_size - 1, buffer_size); // - 1 because of timestamp
+    // - 1 because of timestamp
+    db = new DataBuffer (package_size - 1, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer with size {}", buffer_size);
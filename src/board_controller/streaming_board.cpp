@@ -1,6 +1,7 @@
 #include <string.h>
 
 #include "board_info_getter.h"
+#include "multicast_streamer.h"
 #include "streaming_board.h"
 
 #ifndef _WIN32
@@ -15,9 +16,17 @@ StreamingBoard::StreamingBoard (struct BrainFlowInputParams params)
                   // api to get it so its ok
 {
     client = NULL;
+    batch = NULL;
+    reactor = NULL;
     is_streaming = false;
     keep_alive = false;
     initialized = false;
+    num_rows = 0;
+    timestamp_channel = 0;
+    max_samples = 0;
+    is_first_package = true;
+    expected_sequence_num = 0;
+    is_format_error_logged = false;
 }
 
 StreamingBoard::~StreamingBoard ()
@@ -64,6 +73,7 @@ int StreamingBoard::prepare_session ()
         safe_logger (spdlog::level::err, "failed to init socket: {}", res);
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    batch = new DatagramBatch (max_batch_size, MultiCastStreamer::max_package_size);
     initialized = true;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -110,15 +120,38 @@ int StreamingBoard::start_stream (int buffer_size, char *streamer_params)
         safe_logger (spdlog::level::err, "failed to get num rows for {}", board_id);
         return res;
     }
-    db = new DataBuffer (num_channels - 1, buffer_size); // -1 due to timestamps
+    // -1 due to timestamps
+    db = new DataBuffer (num_channels - 1, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer");
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
 
+    num_rows = num_channels;
+    get_timestamp_channel (board_id, &timestamp_channel);
+    max_samples = (MultiCastStreamer::max_package_size - (int)sizeof (MultiCastPackageHeader)) /
+        ((int)sizeof (double) * num_rows);
+    samples.resize (max_samples * (num_rows - 1));
+    timestamps.resize (max_samples);
+    is_first_package = true;
+    expected_sequence_num = 0;
+    is_format_error_logged = false;
+
     keep_alive = true;
-    streaming_thread = std::thread ([this] { this->read_thread (); });
+    reactor = IOReactor::get_instance ();
+    if ((reactor != NULL) &&
+        (reactor->add (client->get_file_descriptor (),
+             [this] (bool is_hung_up) { this->on_reactor_event (is_hung_up); }) !=
+            (int)IOReactorReturnCodes::STATUS_OK))
+    {
+        safe_logger (spdlog::level::warn, "failed to register socket in reactor, use thread");
+        reactor = NULL;
+    }
+    if (reactor == NULL)
+    {
+        streaming_thread = std::thread ([this] { this->read_thread (); });
+    }
     is_streaming = true;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -129,7 +162,16 @@ int StreamingBoard::stop_stream ()
     {
         keep_alive = false;
         is_streaming = false;
-        streaming_thread.join ();
+        if (reactor != NULL)
+        {
+            // doesnt wait for socket timeout
+            reactor->remove (client->get_file_descriptor ());
+            reactor = NULL;
+        }
+        else
+        {
+            streaming_thread.join ();
+        }
         if (streamer)
         {
             delete streamer;
@@ -157,36 +199,102 @@ int StreamingBoard::release_session ()
             delete client;
             client = NULL;
         }
+        if (batch)
+        {
+            delete batch;
+            batch = NULL;
+        }
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void StreamingBoard::read_thread ()
 {
-    // format for incomming package is determined by original board
-    int num_channels = 0;
-    get_num_rows (board_id, &num_channels);
-    int bytes_per_recv = sizeof (double) * num_channels;
-    double *package = new double[num_channels];
-    num_channels--;
-    int timestamp_channel = 0;
-    get_timestamp_channel (board_id, &timestamp_channel);
-    int res = 0;
+    while (keep_alive)
+    {
+        read_packages ();
+    }
+}
 
+void StreamingBoard::on_reactor_event (bool is_hung_up)
+{
+    read_packages ();
+    if (is_hung_up)
+    {
+        // socket is not polled anymore, board stays in streaming state until stop_stream
+        safe_logger (spdlog::level::warn, "socket for {}:{} hung up, no more data will be received",
+            params.ip_address.c_str (), params.ip_port);
+    }
+}
+
+void StreamingBoard::read_packages ()
+{
     while (keep_alive)
     {
-        res = client->recv (package, bytes_per_recv);
-        if (res != bytes_per_recv)
+        int res = client->recv_batch (batch);
+        if (res < 0)
+        {
+            // timeout or no more datagrams in non blocking mode
+            return;
+        }
+        for (int i = 0; i < res; i++)
         {
-            safe_logger (
-                spdlog::level::trace, "unable to read {} bytes, read {}", bytes_per_recv, res);
-            continue;
+            handle_package (batch->get_datagram (i), batch->get_datagram_size (i));
         }
+    }
+}
 
-        double timestamp = package[timestamp_channel];
-        streamer->stream_data (package, num_channels, timestamp);
-        db->add_data (timestamp,
-            package); // here package is bigger but add_data will not copy bytes for timestamp
+void StreamingBoard::handle_package (const unsigned char *package, int size)
+{
+    // single row without header from streamer with batch size 1 or from older version
+    if (size == (int)sizeof (double) * num_rows)
+    {
+        add_rows (package, 1);
+        return;
+    }
+    if (size < (int)sizeof (MultiCastPackageHeader))
+    {
+        report_format_error ("unable to read package header, read {} bytes", size);
+        return;
+    }
+    MultiCastPackageHeader header;
+    memcpy (&header, package, sizeof (header));
+    if ((header.magic != MULTICAST_PACKAGE_MAGIC) || (header.version != MULTICAST_PACKAGE_VERSION))
+    {
+        report_format_error ("unsupported package format, size {}, expected {} bytes or version {}",
+            size, (int)sizeof (double) * num_rows, MULTICAST_PACKAGE_VERSION);
+        return;
+    }
+    int num_samples = (int)header.num_samples;
+    if (((int)header.num_rows != num_rows) || (num_samples > max_samples) ||
+        (size != (int)sizeof (header) + (int)sizeof (double) * num_samples * num_rows))
+    {
+        report_format_error ("invalid package, num rows {}, expected {}, size {}",
+            (int)header.num_rows, num_rows, size);
+        return;
+    }
+    if ((!is_first_package) && (header.sequence_num != expected_sequence_num))
+    {
+        safe_logger (
+            spdlog::level::trace, "lost {} packages", header.sequence_num - expected_sequence_num);
+    }
+    is_first_package = false;
+    expected_sequence_num = header.sequence_num + 1;
+    add_rows (package + sizeof (header), num_samples);
+}
+
+void StreamingBoard::add_rows (const unsigned char *rows, int num_samples)
+{
+    // datagrams in batch are not aligned to double
+    int num_channels = num_rows - 1;
+    size_t row_size = sizeof (double) * num_rows;
+    for (int i = 0; i < num_samples; i++)
+    {
+        memcpy (samples.data () + i * num_channels, rows + i * row_size,
+            sizeof (double) * num_channels);
+        memcpy (timestamps.data () + i, rows + i * row_size + sizeof (double) * timestamp_channel,
+            sizeof (double));
     }
-    delete[] package;
+    streamer->stream_data_batch (samples.data (), num_channels, timestamps.data (), num_samples);
+    db->add_data_batch (timestamps.data (), samples.data (), num_samples);
 }
@@ -78,7 +78,7 @@ int SyntheticBoard::start_stream (int buffer_size, char *streamer_params)
     {
         return res;
     }
-    db = new DataBuffer (SyntheticBoard::package_size, buffer_size);
+    db = new DataBuffer (SyntheticBoard::package_size, buffer_size, buffer_layout, &stats);
     if (!db->is_ready ())
     {
         safe_logger (spdlog::level::err, "unable to prepare buffer with size {}", buffer_size);
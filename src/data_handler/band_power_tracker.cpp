@@ -0,0 +1,174 @@
+#include <string.h>
+
+#include "band_power_tracker.h"
+#include "brainflow_constants.h"
+#include "data_handler.h"
+#include "worker_pool.h"
+
+
+BandPowerTracker::BandPowerTracker (
+    int num_channels, int sampling_rate, int nfft, int window_size, bool apply_filters)
+{
+    this->num_channels = num_channels;
+    this->sampling_rate = sampling_rate;
+    this->nfft = nfft;
+    this->apply_filters = apply_filters;
+    // the same overlap as in get_avg_band_powers and the same number of segments as get_psd_welch
+    // uses for window_size
+    step = nfft - 4 * nfft / 5;
+    psd_len = nfft / 2 + 1;
+    num_segments = 1;
+    if (window_size > nfft)
+    {
+        num_segments = (window_size - nfft - 1) / step + 1;
+    }
+    segments_count = 0;
+    channels.resize (num_channels);
+    for (ChannelState &channel : channels)
+    {
+        channel.pending.reserve (nfft + step);
+        channel.segments.resize ((size_t)num_segments * psd_len);
+    }
+}
+
+BandPowerTracker::~BandPowerTracker ()
+{
+    for (ChannelState &channel : channels)
+    {
+        for (int filter_id : channel.filter_ids)
+        {
+            release_filter (filter_id);
+        }
+    }
+}
+
+int BandPowerTracker::prepare ()
+{
+    if (!apply_filters)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    // the same filters as in get_avg_band_powers, but they keep state between calls instead of
+    // restarting for each window
+    const int num_filters = 3;
+    const int operations[num_filters] = {(int)FilterOperations::BANDSTOP,
+        (int)FilterOperations::BANDSTOP, (int)FilterOperations::BANDPASS};
+    const double center_freqs[num_filters] = {50.0, 60.0, 24.0};
+    const double band_widths[num_filters] = {4.0, 4.0, 47.0};
+    for (ChannelState &channel : channels)
+    {
+        for (int i = 0; i < num_filters; i++)
+        {
+            int filter_id = 0;
+            int res = create_filter (operations[i], sampling_rate, center_freqs[i],
+                band_widths[i], 4, (int)FilterTypes::BUTTERWORTH, 0.0, &filter_id);
+            if (res != (int)BrainFlowExitCodes::STATUS_OK)
+            {
+                return res;
+            }
+            channel.filter_ids.push_back (filter_id);
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BandPowerTracker::add_data (double *data, int num_samples)
+{
+    std::lock_guard<std::mutex> lock (m);
+    // all channels get the same samples, so they have the same number of pending samples and
+    // new segments
+    long long total = (long long)channels[0].pending.size () + num_samples;
+    int new_segments = 0;
+    if (total >= nfft)
+    {
+        new_segments = (int)((total - nfft) / step + 1);
+    }
+    std::vector<int> exit_codes (num_channels, (int)BrainFlowExitCodes::STATUS_OK);
+    WorkerPool::get_instance ().parallel_for (num_channels,
+        [this, data, num_samples, new_segments, &exit_codes] (int i, WorkerScratch &scratch) {
+            exit_codes[i] = add_channel_data (
+                i, data + (size_t)i * num_samples, num_samples, new_segments, scratch);
+        });
+    segments_count += new_segments;
+    for (int i = 0; i < num_channels; i++)
+    {
+        if (exit_codes[i] != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return exit_codes[i];
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BandPowerTracker::add_channel_data (
+    int channel, double *data, int num_samples, int new_segments, WorkerScratch &scratch)
+{
+    ChannelState &state = channels[channel];
+    size_t offset = state.pending.size ();
+    state.pending.resize (offset + num_samples);
+    double *samples = state.pending.data () + offset;
+    memcpy (samples, data, sizeof (double) * num_samples);
+    for (int filter_id : state.filter_ids)
+    {
+        int res = process_filter (filter_id, samples, num_samples);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    // segments which would be dropped immediately are not calculated
+    int first_segment = (new_segments > num_segments) ? new_segments - num_segments : 0;
+    double *freqs = scratch.get_buffer (0, psd_len);
+    for (int i = first_segment; i < new_segments; i++)
+    {
+        size_t ring_index = (size_t)((segments_count + i) % num_segments);
+        int res = ::get_psd (state.pending.data () + (size_t)i * step, nfft, sampling_rate,
+            (int)WindowFunctions::HANNING, state.segments.data () + ring_index * psd_len, freqs);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    size_t used = (size_t)new_segments * step;
+    state.pending.erase (state.pending.begin (), state.pending.begin () + used);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BandPowerTracker::get_psd (double *ampls, double *freqs)
+{
+    std::lock_guard<std::mutex> lock (m);
+    if (segments_count == 0)
+    {
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    // sum segments from the oldest one in the same order as get_psd_welch does
+    int count = (segments_count < num_segments) ? (int)segments_count : num_segments;
+    long long oldest = segments_count - count;
+    for (int c = 0; c < num_channels; c++)
+    {
+        const ChannelState &state = channels[c];
+        double *output = ampls + (size_t)c * psd_len;
+        for (int i = 0; i < psd_len; i++)
+        {
+            output[i] = 0.0;
+        }
+        for (long long k = oldest; k < segments_count; k++)
+        {
+            const double *segment = state.segments.data () + (size_t)(k % num_segments) * psd_len;
+            for (int i = 0; i < psd_len; i++)
+            {
+                output[i] += segment[i];
+            }
+        }
+        for (int i = 0; i < nfft / 2; i++)
+        {
+            output[i] /= count;
+        }
+    }
+    double freq_res = (double)sampling_rate / (double)nfft;
+    for (int i = 0; i < psd_len; i++)
+    {
+        freqs[i] = i * freq_res;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
@@ -0,0 +1,266 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "csv_reader.h"
+
+#define CSV_BLOCK_SIZE 1048576
+// more digits dont fit to uint64_t
+#define MAX_FAST_DIGITS 19
+#define MAX_FAST_MANTISSA 9007199254740992ULL // 2^53
+#define MAX_FAST_EXPONENT 22
+
+
+// all of them are exactly representable as double
+static const double powers_of_ten[MAX_FAST_EXPONENT + 1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static inline bool is_space (char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\r');
+}
+
+static inline bool is_digit (char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+static bool is_blank (const char *line, size_t line_len)
+{
+    for (size_t i = 0; i < line_len; i++)
+    {
+        if (!is_space (line[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+CSVReader::CSVReader ()
+{
+    fp = NULL;
+    pos = 0;
+    len = 0;
+    eof = false;
+}
+
+CSVReader::~CSVReader ()
+{
+    if (fp != NULL)
+    {
+        fclose (fp);
+        fp = NULL;
+    }
+}
+
+bool CSVReader::open (const char *file_name)
+{
+    if (file_name == NULL)
+    {
+        return false;
+    }
+    // binary mode to avoid conversion of line endings on windows, \r is handled in next_line
+    fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return false;
+    }
+    buffer.resize (CSV_BLOCK_SIZE);
+    return true;
+}
+
+bool CSVReader::read_block ()
+{
+    // move incomplete line to the beginning, buffer is extended if line doesnt fit
+    size_t remaining = len - pos;
+    if (pos > 0)
+    {
+        memmove (buffer.data (), buffer.data () + pos, remaining);
+    }
+    pos = 0;
+    len = remaining;
+    if (len == buffer.size ())
+    {
+        buffer.resize (buffer.size () * 2);
+    }
+    size_t num_read = fread (buffer.data () + len, 1, buffer.size () - len, fp);
+    len += num_read;
+    return num_read > 0;
+}
+
+bool CSVReader::next_line (const char **line, size_t *line_len)
+{
+    if (fp == NULL)
+    {
+        return false;
+    }
+    while (true)
+    {
+        const char *start = buffer.data () + pos;
+        const char *line_end = (const char *)memchr (start, '\n', len - pos);
+        size_t cur_len = 0;
+        if (line_end != NULL)
+        {
+            cur_len = (size_t)(line_end - start);
+            pos += cur_len + 1;
+        }
+        else if (!eof)
+        {
+            eof = !read_block ();
+            continue;
+        }
+        else if (pos < len)
+        {
+            // the last line without line ending
+            cur_len = len - pos;
+            pos = len;
+        }
+        else
+        {
+            return false;
+        }
+        if ((cur_len > 0) && (start[cur_len - 1] == '\r'))
+        {
+            cur_len--;
+        }
+        if (!is_blank (start, cur_len))
+        {
+            *line = start;
+            *line_len = cur_len;
+            return true;
+        }
+    }
+}
+
+int CSVReader::count_fields (const char *line, size_t line_len)
+{
+    int num_fields = 1;
+    const char *end = line + line_len;
+    while ((line = (const char *)memchr (line, ',', end - line)) != NULL)
+    {
+        num_fields++;
+        line++;
+    }
+    return num_fields;
+}
+
+bool CSVReader::parse_line (
+    const char *line, size_t line_len, double *values, size_t stride, int num_values)
+{
+    const char *end = line + line_len;
+    const char *field_start = line;
+    for (int i = 0; i < num_values; i++)
+    {
+        const char *field_end = (const char *)memchr (field_start, ',', end - field_start);
+        bool is_last = (i == num_values - 1);
+        // the last field ends at the end of line, others at comma
+        if ((is_last) != (field_end == NULL))
+        {
+            return false;
+        }
+        if (is_last)
+        {
+            field_end = end;
+        }
+        if (!parse_number (field_start, field_end, values + i * stride))
+        {
+            return false;
+        }
+        field_start = field_end + 1;
+    }
+    return true;
+}
+
+// if mantissa and power of ten are exact doubles result of single multiplication or division is
+// correctly rounded, so its the same as strtod. Other numbers(long mantissa, big exponents, nan,
+// inf) are passed to strtod
+bool CSVReader::parse_number (const char *begin, const char *end, double *value)
+{
+    while ((begin < end) && (is_space (*begin)))
+    {
+        begin++;
+    }
+    while ((end > begin) && (is_space (end[-1])))
+    {
+        end--;
+    }
+    const char *p = begin;
+    bool negative = false;
+    if ((p < end) && ((*p == '-') || (*p == '+')))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    for (; (p < end) && (is_digit (*p)); p++, num_digits++)
+    {
+        mantissa = mantissa * 10 + (*p - '0');
+    }
+    if ((p < end) && (*p == '.'))
+    {
+        for (p++; (p < end) && (is_digit (*p)); p++, num_digits++)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            exponent--;
+        }
+    }
+    if ((num_digits == 0) || (num_digits > MAX_FAST_DIGITS))
+    {
+        return parse_number_slow (begin, end, value);
+    }
+    if ((p < end) && ((*p == 'e') || (*p == 'E')))
+    {
+        p++;
+        bool negative_exponent = false;
+        if ((p < end) && ((*p == '-') || (*p == '+')))
+        {
+            negative_exponent = (*p == '-');
+            p++;
+        }
+        int exponent_value = 0;
+        int num_exponent_digits = 0;
+        for (; (p < end) && (is_digit (*p)) && (exponent_value < 1000); p++, num_exponent_digits++)
+        {
+            exponent_value = exponent_value * 10 + (*p - '0');
+        }
+        if (num_exponent_digits == 0)
+        {
+            return parse_number_slow (begin, end, value);
+        }
+        exponent += negative_exponent ? -exponent_value : exponent_value;
+    }
+    if ((p != end) || (mantissa > MAX_FAST_MANTISSA) || (exponent < -MAX_FAST_EXPONENT) ||
+        (exponent > MAX_FAST_EXPONENT))
+    {
+        return parse_number_slow (begin, end, value);
+    }
+    double result = (double)mantissa;
+    if (exponent < 0)
+    {
+        result /= powers_of_ten[-exponent];
+    }
+    else
+    {
+        result *= powers_of_ten[exponent];
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+bool CSVReader::parse_number_slow (const char *begin, const char *end, double *value)
+{
+    if (begin == end)
+    {
+        return false;
+    }
+    // strtod needs null terminated string
+    std::string number (begin, end);
+    char *number_end = NULL;
+    *value = strtod (number.c_str (), &number_end);
+    return (number_end == number.c_str () + number.size ());
+}
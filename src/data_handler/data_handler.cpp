@@ -1,5 +1,5 @@
+#include <functional>
 #include <math.h>
-#include <sstream>
 #include <stdexcept>
 #include <stdint.h>
 #include <stdio.h>
@@ -8,18 +8,24 @@
 #include <thread>
 #include <vector>
 
+#include "band_power_tracker.h"
 #include "brainflow_constants.h"
+#include "csv_reader.h"
 #include "data_handler.h"
 #include "downsample_operators.h"
+#include "dsp_kernels.h"
+#include "fft_plan_cache.h"
+#include "handle_registry.h"
+#include "polyphase_resampler.h"
 #include "rolling_filter.h"
 #include "wavelet_helpers.h"
+#include "wavelet_plan_cache.h"
+#include "worker_pool.h"
 
 #include "DspFilters/Dsp.h"
 
-#include "wauxlib.h"
 #include "wavelib.h"
 
-#include "FFTReal.h"
 #include "spdlog/sinks/null_sink.h"
 #include "spdlog/spdlog.h"
 #define LOGGER_NAME "data_logger"
@@ -37,10 +43,20 @@ std::shared_ptr<spdlog::logger> data_logger =
 std::shared_ptr<spdlog::logger> data_logger = spdlog::stderr_logger_mt (LOGGER_NAME);
 #endif
 
+// persistent filters created by create_filter and create_rolling_filter
+static HandleRegistry<Dsp::Filter> filters;
+static HandleRegistry<RollingFilter<double>> rolling_filters;
+static HandleRegistry<BandPowerTracker> band_power_trackers;
+
 ///////////////////////
 /////// Helpers ///////
-void calc_per_channel_band_powers (double *raw_data, int row_num_start, int row_num_stop, int cols,
-    int nfft, int sampling_rate, int aply_filters, double **bands, int *exit_codes);
+int calc_band_powers (double *raw_data, int row, int cols, int nfft, int sampling_rate,
+    int apply_filters, std::vector<std::vector<double>> &bands, WorkerScratch &scratch);
+int calc_band_powers_from_psd (
+    double *ampls, double *freqs, int nfft, std::vector<std::vector<double>> &bands, int row);
+int get_band_powers_nfft (int sampling_rate, int cols, int *nfft);
+void calc_avg_band_powers (
+    std::vector<std::vector<double>> &bands, double *avg_band_powers, double *stddev_band_powers);
 
 ////////////////////////
 ///// Main Methods /////
@@ -94,198 +110,355 @@ int set_log_level (int level)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int set_num_threads (int num_threads)
+{
+    if (!WorkerPool::get_instance ().set_num_threads (num_threads))
+    {
+        data_logger->error ("Number of threads must be >= 1. Num threads:{}", num_threads);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-int perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
-    int filter_type, double ripple)
+
+// creates filter for all supported operations and filter types, used by perform_* methods and by
+// persistent filters which keep their state between process_filter calls
+static int create_dsp_filter (int filter_operation, int sampling_rate, double freq,
+    double band_width, int order, int filter_type, double ripple, Dsp::Filter **filter)
 {
-    int numSamples = 2000;
-    double *filter_data[1];
-    filter_data[0] = data;
-    Dsp::Filter *f = NULL;
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data))
+    if ((order < 1) || (order > MAX_FILTER_ORDER))
     {
-        data_logger->error ("Order must be from 1-8 and data cannot be empty. Order:{} , Data:{}",
-            order, (data != NULL));
+        data_logger->error ("Order must be from 1-8. Order:{}", order);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    switch (static_cast<FilterTypes> (filter_type))
+    Dsp::Filter *f = NULL;
+    // "1024" is the number of samples over which to fade parameter changes
+    switch (static_cast<FilterOperations> (filter_operation))
     {
-        case FilterTypes::BUTTERWORTH:
-            // "1024" is the number of samples over which to fade parameter changes
-            f = new Dsp::SmoothedFilterDesign<Dsp::Butterworth::Design::LowPass<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
+        case FilterOperations::LOWPASS:
+            switch (static_cast<FilterTypes> (filter_type))
+            {
+                case FilterTypes::BUTTERWORTH:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Butterworth::Design::LowPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::CHEBYSHEV_TYPE_1:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::ChebyshevI::Design::LowPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::BESSEL:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Bessel::Design::LowPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (1024);
+                    break;
+                default:
+                    break;
+            }
             break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::SmoothedFilterDesign<Dsp::ChebyshevI::Design::LowPass<MAX_FILTER_ORDER>, 1,
-                Dsp::DirectFormII> (1024);
+        case FilterOperations::HIGHPASS:
+            switch (static_cast<FilterTypes> (filter_type))
+            {
+                case FilterTypes::BUTTERWORTH:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Butterworth::Design::HighPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::CHEBYSHEV_TYPE_1:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::ChebyshevI::Design::HighPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::BESSEL:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Bessel::Design::HighPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (1024);
+                    break;
+                default:
+                    break;
+            }
+            break;
+        case FilterOperations::BANDPASS:
+            switch (static_cast<FilterTypes> (filter_type))
+            {
+                case FilterTypes::BUTTERWORTH:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Butterworth::Design::BandPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::CHEBYSHEV_TYPE_1:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::ChebyshevI::Design::BandPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::BESSEL:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Bessel::Design::BandPass<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (1024);
+                    break;
+                default:
+                    break;
+            }
             break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::SmoothedFilterDesign<Dsp::Bessel::Design::LowPass<MAX_FILTER_ORDER>, 1,
-                Dsp::DirectFormII> (1024);
+        case FilterOperations::BANDSTOP:
+            switch (static_cast<FilterTypes> (filter_type))
+            {
+                case FilterTypes::BUTTERWORTH:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Butterworth::Design::BandStop<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::CHEBYSHEV_TYPE_1:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::ChebyshevI::Design::BandStop<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (
+                        1024);
+                    break;
+                case FilterTypes::BESSEL:
+                    f = new Dsp::SmoothedFilterDesign<
+                        Dsp::Bessel::Design::BandStop<MAX_FILTER_ORDER>, 1, Dsp::DirectFormII> (1024);
+                    break;
+                default:
+                    break;
+            }
             break;
         default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
+            data_logger->error ("Filter operation {} is Invalid", filter_operation);
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    if (f == NULL)
+    {
+        data_logger->error ("Filter type {} is Invalid", filter_type);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
 
     Dsp::Params params;
     params[0] = sampling_rate; // sample rate
     params[1] = order;         // order
-    params[2] = cutoff;        // cutoff
+    params[2] = freq;          // cutoff or center freq
+    int ripple_id = 3;
+    if ((filter_operation == (int)FilterOperations::BANDPASS) ||
+        (filter_operation == (int)FilterOperations::BANDSTOP))
+    {
+        params[3] = band_width;
+        ripple_id = 4;
+    }
     if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
     {
-        params[3] = ripple; // ripple
+        params[ripple_id] = ripple; // ripple
     }
     f->setParams (params);
-    f->process (data_len, filter_data);
-    delete f;
-
+    *filter = f;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int perform_highpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
-    int filter_type, double ripple)
+static int apply_filter (double *data, int data_len, int filter_operation, int sampling_rate,
+    double freq, double band_width, int order, int filter_type, double ripple)
 {
+    if (!data)
+    {
+        data_logger->error ("Data cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     Dsp::Filter *f = NULL;
+    int res = create_dsp_filter (
+        filter_operation, sampling_rate, freq, band_width, order, filter_type, ripple, &f);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
     double *filter_data[1];
     filter_data[0] = data;
+    f->process (data_len, filter_data);
+    delete f;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data))
+static int gcd (int a, int b)
+{
+    while (b != 0)
     {
-        data_logger->error ("Order must be from 1-8 and data cannot be empty. Order:{} , Data:{}",
-            order, (data != NULL));
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        int tmp = a % b;
+        a = b;
+        b = tmp;
     }
-    switch (static_cast<FilterTypes> (filter_type))
+    return a;
+}
+
+// there is no filter object for EACH operation, it doesnt change data
+static int create_rolling_filter_object (
+    int period, int agg_operation, RollingFilter<double> **filter)
+{
+    switch (static_cast<AggOperations> (agg_operation))
     {
-        case FilterTypes::BUTTERWORTH:
-            // "1024" is the number of samples over which to fade parameter changes
-            f = new Dsp::SmoothedFilterDesign<Dsp::Butterworth::Design::HighPass<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::SmoothedFilterDesign<Dsp::ChebyshevI::Design::HighPass<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
+        case AggOperations::MEAN:
+            *filter = new RollingAverage<double> (period);
             break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::SmoothedFilterDesign<Dsp::Bessel::Design::HighPass<MAX_FILTER_ORDER>, 1,
-                Dsp::DirectFormII> (1024);
+        case AggOperations::MEDIAN:
+            *filter = new RollingMedian<double> (period);
             break;
         default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
+            data_logger->error ("Invalid aggregate opteration:{}", agg_operation);
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = cutoff;        // cutoff
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
-    {
-        params[3] = ripple; // ripple
-    }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    delete f;
-
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int perform_bandpass (double *data, int data_len, int sampling_rate, double center_freq,
-    double band_width, int order, int filter_type, double ripple)
+// checks that all channels are valid rows and there are no duplicates(rows are processed in
+// different threads)
+static bool validate_channels (int rows, int *channels, int num_channels)
 {
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
-
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data))
+    if ((channels == NULL) || (num_channels < 1) || (num_channels > rows))
     {
-        data_logger->error ("Order must be from 1-8 and data cannot be empty. Order:{} , Data:{}",
-            order, (data != NULL));
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return false;
     }
-    switch (static_cast<FilterTypes> (filter_type))
+    std::vector<bool> used (rows, false);
+    for (int i = 0; i < num_channels; i++)
     {
-        case FilterTypes::BUTTERWORTH:
-            // "1024" is the number of samples over which to fade parameter changes
-            f = new Dsp::SmoothedFilterDesign<Dsp::Butterworth::Design::BandPass<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::SmoothedFilterDesign<Dsp::ChebyshevI::Design::BandPass<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::SmoothedFilterDesign<Dsp::Bessel::Design::BandPass<MAX_FILTER_ORDER>, 1,
-                Dsp::DirectFormII> (1024);
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid. ", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        if ((channels[i] < 0) || (channels[i] >= rows) || (used[channels[i]]))
+        {
+            return false;
+        }
+        used[channels[i]] = true;
     }
+    return true;
+}
 
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = center_freq;   // center freq
-    params[3] = band_width;
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
+// calls process_channel for 0..num_channels - 1 in worker pool, returns the first error
+static int process_channels (int num_channels, const std::function<int (int)> &process_channel)
+{
+    std::vector<int> exit_codes (num_channels, (int)BrainFlowExitCodes::STATUS_OK);
+    WorkerPool::get_instance ().parallel_for (
+        num_channels, [&exit_codes, &process_channel] (int i, WorkerScratch &) {
+            exit_codes[i] = process_channel (i);
+        });
+    for (int i = 0; i < num_channels; i++)
     {
-        params[4] = ripple; // ripple
+        if (exit_codes[i] != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return exit_codes[i];
+        }
     }
-    f->setParams (params);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    f->process (data_len, filter_data);
-    delete f;
+static int apply_filter_multi (double *data, int rows, int cols, int *channels, int num_channels,
+    int filter_operation, int sampling_rate, double freq, double band_width, int order,
+    int filter_type, double ripple)
+{
+    if ((data == NULL) || (cols < 1) || (!validate_channels (rows, channels, num_channels)))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [&] (int i) {
+        return apply_filter (data + (size_t)channels[i] * cols, cols, filter_operation,
+            sampling_rate, freq, band_width, order, filter_type, ripple);
+    });
+}
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+int perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
+    int filter_type, double ripple)
+{
+    return apply_filter (data, data_len, (int)FilterOperations::LOWPASS, sampling_rate, cutoff,
+        0.0, order, filter_type, ripple);
+}
+
+int perform_highpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
+    int filter_type, double ripple)
+{
+    return apply_filter (data, data_len, (int)FilterOperations::HIGHPASS, sampling_rate, cutoff,
+        0.0, order, filter_type, ripple);
+}
+
+int perform_bandpass (double *data, int data_len, int sampling_rate, double center_freq,
+    double band_width, int order, int filter_type, double ripple)
+{
+    return apply_filter (data, data_len, (int)FilterOperations::BANDPASS, sampling_rate,
+        center_freq, band_width, order, filter_type, ripple);
 }
 
 int perform_bandstop (double *data, int data_len, int sampling_rate, double center_freq,
     double band_width, int order, int filter_type, double ripple)
 {
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
+    return apply_filter (data, data_len, (int)FilterOperations::BANDSTOP, sampling_rate,
+        center_freq, band_width, order, filter_type, ripple);
+}
+
+int perform_lowpass_multi (double *data, int rows, int cols, int *channels, int num_channels,
+    int sampling_rate, double cutoff, int order, int filter_type, double ripple)
+{
+    return apply_filter_multi (data, rows, cols, channels, num_channels,
+        (int)FilterOperations::LOWPASS, sampling_rate, cutoff, 0.0, order, filter_type, ripple);
+}
 
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data))
+int perform_highpass_multi (double *data, int rows, int cols, int *channels, int num_channels,
+    int sampling_rate, double cutoff, int order, int filter_type, double ripple)
+{
+    return apply_filter_multi (data, rows, cols, channels, num_channels,
+        (int)FilterOperations::HIGHPASS, sampling_rate, cutoff, 0.0, order, filter_type, ripple);
+}
+
+int perform_bandpass_multi (double *data, int rows, int cols, int *channels, int num_channels,
+    int sampling_rate, double center_freq, double band_width, int order, int filter_type,
+    double ripple)
+{
+    return apply_filter_multi (data, rows, cols, channels, num_channels,
+        (int)FilterOperations::BANDPASS, sampling_rate, center_freq, band_width, order,
+        filter_type, ripple);
+}
+
+int perform_bandstop_multi (double *data, int rows, int cols, int *channels, int num_channels,
+    int sampling_rate, double center_freq, double band_width, int order, int filter_type,
+    double ripple)
+{
+    return apply_filter_multi (data, rows, cols, channels, num_channels,
+        (int)FilterOperations::BANDSTOP, sampling_rate, center_freq, band_width, order,
+        filter_type, ripple);
+}
+
+int create_filter (int filter_operation, int sampling_rate, double freq, double band_width,
+    int order, int filter_type, double ripple, int *filter_id)
+{
+    if (filter_id == NULL)
     {
-        data_logger->error ("Order must be from 1-8 and data cannot be empty. Order:{} , Data:{}",
-            order, (data != NULL));
+        data_logger->error ("filter_id cannot be NULL");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    switch (static_cast<FilterTypes> (filter_type))
+    Dsp::Filter *f = NULL;
+    int res = create_dsp_filter (
+        filter_operation, sampling_rate, freq, band_width, order, filter_type, ripple, &f);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        case FilterTypes::BUTTERWORTH:
-            // "1024" is the number of samples over which to fade parameter changes
-            f = new Dsp::SmoothedFilterDesign<Dsp::Butterworth::Design::BandStop<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::SmoothedFilterDesign<Dsp::ChebyshevI::Design::BandStop<MAX_FILTER_ORDER>,
-                1, Dsp::DirectFormII> (1024);
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::SmoothedFilterDesign<Dsp::Bessel::Design::BandStop<MAX_FILTER_ORDER>, 1,
-                Dsp::DirectFormII> (1024);
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return res;
     }
+    *filter_id = filters.add (f);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = center_freq;   // center freq
-    params[3] = band_width;
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
+int process_filter (int filter_id, double *data, int data_len)
+{
+    if ((data == NULL) || (data_len < 0))
     {
-        params[4] = ripple; // ripple
+        data_logger->error ("Data cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    f->setParams (params);
+    std::shared_ptr<Dsp::Filter> f = filters.get (filter_id);
+    if (!f)
+    {
+        data_logger->error ("Filter {} doesnt exist", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    double *filter_data[1];
+    filter_data[0] = data;
     f->process (data_len, filter_data);
-    delete f;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int release_filter (int filter_id)
+{
+    if (!filters.remove (filter_id))
+    {
+        data_logger->error ("Filter {} doesnt exist", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -297,21 +470,15 @@ int perform_rolling_filter (double *data, int data_len, int period, int agg_oper
             period, (data != NULL));
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-
+    if (agg_operation == (int)AggOperations::EACH)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
     RollingFilter<double> *filter = NULL;
-    switch (static_cast<AggOperations> (agg_operation))
+    int res = create_rolling_filter_object (period, agg_operation, &filter);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        case AggOperations::MEAN:
-            filter = new RollingAverage<double> (period);
-            break;
-        case AggOperations::MEDIAN:
-            filter = new RollingMedian<double> (period);
-            break;
-        case AggOperations::EACH:
-            return (int)BrainFlowExitCodes::STATUS_OK;
-        default:
-            data_logger->error ("Invalid aggregate opteration:{}", agg_operation);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return res;
     }
     for (int i = 0; i < data_len; i++)
     {
@@ -322,6 +489,54 @@ int perform_rolling_filter (double *data, int data_len, int period, int agg_oper
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int create_rolling_filter (int period, int agg_operation, int *filter_id)
+{
+    if ((period <= 0) || (filter_id == NULL))
+    {
+        data_logger->error ("Period must be > 0 and filter_id cannot be NULL. Period:{}", period);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    RollingFilter<double> *filter = NULL;
+    int res = create_rolling_filter_object (period, agg_operation, &filter);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    *filter_id = rolling_filters.add (filter);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int process_rolling_filter (int filter_id, double *data, int data_len)
+{
+    if ((data == NULL) || (data_len < 0))
+    {
+        data_logger->error ("Data cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<RollingFilter<double>> filter = rolling_filters.get (filter_id);
+    if (!filter)
+    {
+        data_logger->error ("Rolling filter {} doesnt exist", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    for (int i = 0; i < data_len; i++)
+    {
+        filter->add_data (data[i]);
+        data[i] = filter->get_value ();
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int release_rolling_filter (int filter_id)
+{
+    if (!rolling_filters.remove (filter_id))
+    {
+        data_logger->error ("Rolling filter {} doesnt exist", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int perform_downsampling (
     double *data, int data_len, int period, int agg_operation, double *output_data)
 {
@@ -332,6 +547,13 @@ int perform_downsampling (
             *data, period, *output_data);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    if (agg_operation == (int)AggOperations::FIR_DECIMATION)
+    {
+        // lowpass filter before decimation to avoid aliasing
+        PolyphaseResampler resampler (1, period);
+        resampler.process (data, data_len, output_data, data_len / period);
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
     double (*downsampling_op) (double *, int);
     switch (static_cast<AggOperations> (agg_operation))
     {
@@ -345,8 +567,9 @@ int perform_downsampling (
             downsampling_op = downsample_each;
             break;
         default:
-            data_logger->error (
-                "Invalid aggregate opteration:{}. Must be mean,median, or each", agg_operation);
+            data_logger->error ("Invalid aggregate opteration:{}. Must be mean,median, each or "
+                                "fir_decimation",
+                agg_operation);
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
     int num_values = data_len / period;
@@ -357,6 +580,46 @@ int perform_downsampling (
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int get_resampled_len (int data_len, int input_rate, int output_rate, int *output_len)
+{
+    if ((data_len < 0) || (input_rate < 1) || (output_rate < 1) || (output_len == NULL))
+    {
+        data_logger->error ("Sampling rates must be > 0. Input:{}, Output:{}", input_rate,
+            output_rate);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int divider = gcd (input_rate, output_rate);
+    PolyphaseResampler resampler (output_rate / divider, input_rate / divider);
+    long long len = resampler.get_output_len (data_len);
+    if (len > INT32_MAX)
+    {
+        data_logger->error ("Output is too big.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    *output_len = (int)len;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int perform_resampling (
+    double *data, int data_len, int input_rate, int output_rate, double *output_data)
+{
+    int output_len = 0;
+    int res = get_resampled_len (data_len, input_rate, output_rate, &output_len);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    if ((data == NULL) || (data_len < 1) || (output_data == NULL))
+    {
+        data_logger->error ("Data and output_data cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int divider = gcd (input_rate, output_rate);
+    PolyphaseResampler resampler (output_rate / divider, input_rate / divider);
+    resampler.process (data, data_len, output_data, output_len);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 // https://github.com/rafat/wavelib/wiki/DWT-Example-Code
 int perform_wavelet_transform (double *data, int data_len, char *wavelet, int decomposition_level,
     double *output_data, int *decomposition_lengths)
@@ -371,42 +634,24 @@ int perform_wavelet_transform (double *data, int data_len, char *wavelet, int de
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    wave_object obj = NULL;
-    wt_object wt = NULL;
-
-    try
+    WaveletPlan *plan = get_wavelet_plan (wavelet, data_len, decomposition_level);
+    if (plan == NULL)
     {
-        obj = wave_init (wavelet);
-        wt = wt_init (obj, "dwt", data_len, decomposition_level);
-        setDWTExtension (wt, "sym");
-        setWTConv (wt, "direct");
-        dwt (wt, data);
-        for (int i = 0; i < wt->outlength; i++)
-        {
-            output_data[i] = wt->output[i];
-        }
-        for (int i = 0; i < decomposition_level + 1; i++)
-        {
-            decomposition_lengths[i] = wt->length[i];
-        }
-        wave_free (obj);
-        wt_free (wt);
-    }
-    catch (const std::exception &e)
-    {
-        if (obj)
-        {
-            wave_free (obj);
-        }
-        if (wt)
-        {
-            wt_free (wt);
-        }
-        // more likely exception here occured because input buffer is to small to perform wavelet
+        // more likely plan was not created because input buffer is to small to perform wavelet
         // transform
         data_logger->error ("Input buffer size issue(likely too small.");
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
+    wt_object wt = plan->wt;
+    dwt (wt, data);
+    for (int i = 0; i < wt->outlength; i++)
+    {
+        output_data[i] = wt->output[i];
+    }
+    for (int i = 0; i < decomposition_level + 1; i++)
+    {
+        decomposition_lengths[i] = wt->length[i];
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -425,44 +670,24 @@ int perform_inverse_wavelet_transform (double *wavelet_coeffs, int original_data
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    wave_object obj;
-    wt_object wt;
-
-    try
-    {
-        obj = wave_init (wavelet);
-        wt = wt_init (obj, "dwt", original_data_len, decomposition_level);
-        setDWTExtension (wt, "sym");
-        setWTConv (wt, "direct");
-        int total_len = 0;
-        for (int i = 0; i < decomposition_level + 1; i++)
-        {
-            wt->length[i] = decomposition_lengths[i];
-            total_len += decomposition_lengths[i];
-        }
-        for (int i = 0; i < total_len; i++)
-        {
-            wt->output[i] = wavelet_coeffs[i];
-        }
-        idwt (wt, output_data);
-        wave_free (obj);
-        wt_free (wt);
-    }
-    catch (const std::exception &e)
+    WaveletPlan *plan = get_wavelet_plan (wavelet, original_data_len, decomposition_level);
+    if (plan == NULL)
     {
-        if (obj)
-        {
-            wave_free (obj);
-        }
-        if (wt)
-        {
-            wt_free (wt);
-        }
         data_logger->error ("Input buffer size issue(likely too small.");
-        // more likely exception here occured because input buffer is to small to perform wavelet
-        // transform
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
+    wt_object wt = plan->wt;
+    int total_len = 0;
+    for (int i = 0; i < decomposition_level + 1; i++)
+    {
+        wt->length[i] = decomposition_lengths[i];
+        total_len += decomposition_lengths[i];
+    }
+    for (int i = 0; i < total_len; i++)
+    {
+        wt->output[i] = wavelet_coeffs[i];
+    }
+    idwt (wt, output_data);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -476,42 +701,33 @@ int perform_wavelet_denoising (double *data, int data_len, char *wavelet, int de
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    denoise_object obj;
-    double *temp = new double[data_len];
-    try
-    {
-        obj = denoise_init (data_len, decomposition_level, wavelet);
-        setDenoiseMethod (obj, "visushrink");
-        setDenoiseWTMethod (obj, "dwt");
-        setDenoiseWTExtension (obj, "sym");
-        setDenoiseParameters (obj, "soft", "all");
-        denoise (obj, data, temp);
-        for (int i = 0; i < data_len; i++)
-        {
-            data[i] = temp[i];
-        }
-        delete[] temp;
-        temp = NULL;
-        denoise_free (obj);
-    }
-    catch (const std::exception &e)
+    WaveletPlan *plan = get_wavelet_plan (wavelet, data_len, decomposition_level);
+    if (plan == NULL)
     {
-        if (temp)
-        {
-            delete[] temp;
-        }
-        if (obj)
-        {
-            denoise_free (obj);
-        }
-        // more likely exception here occured because input buffer is to small to perform wavelet
+        // more likely plan was not created because input buffer is to small to perform wavelet
         // transform
         data_logger->error ("Input buffer size issue(likely too small.");
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
+    plan->denoise (data);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int perform_wavelet_denoising_multi (double *data, int rows, int cols, int *channels,
+    int num_channels, char *wavelet, int decomposition_level)
+{
+    if ((data == NULL) || (cols < 1) || (!validate_channels (rows, channels, num_channels)))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    // plans are thread local, so each worker reuses its own plan for all windows
+    return process_channels (num_channels, [&] (int i) {
+        return perform_wavelet_denoising (
+            data + (size_t)channels[i] * cols, cols, wavelet, decomposition_level);
+    });
+}
+
 /*
    FFTReal output | Positive FFT equiv.   | Negative FFT equiv.
    ---------------+-----------------------+-----------------------
@@ -546,75 +762,42 @@ int perform_fft (
                             "a postive power of 2.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *windowed_data = new double[data_len];
-    // from https://www.edn.com/windowing-functions-improve-fft-results-part-i/
+    FFTPlan *plan = get_fft_plan (data_len);
+    if (plan == NULL)
+    {
+        data_logger->error ("Error with doing FFT processing.");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    double *windowed_data = plan->windowed_data.data ();
     switch (static_cast<WindowFunctions> (window_function))
     {
         case WindowFunctions::NO_WINDOW:
-            for (int i = 0; i < data_len; i++)
-            {
-                windowed_data[i] = data[i];
-            }
+            memcpy (windowed_data, data, sizeof (double) * data_len);
             break;
         case WindowFunctions::HAMMING:
-            for (int i = 0; i < data_len; i++)
-            {
-                windowed_data[i] = data[i] * (0.54 - 0.46 * cos (2.0 * M_PI * i / data_len));
-            }
-            break;
         case WindowFunctions::HANNING:
-            for (int i = 0; i < data_len; i++)
-            {
-                windowed_data[i] = data[i] * (0.5 - 0.5 * cos (2.0 * M_PI * i / data_len));
-            }
-            break;
         case WindowFunctions::BLACKMAN_HARRIS:
-            for (int i = 0; i < data_len; i++)
-            {
-                windowed_data[i] = data[i] *
-                    (0.355768 - 0.487396 * cos (2.0 * M_PI * i / data_len) +
-                        0.144232 * cos (4.0 * M_PI * i / data_len) -
-                        0.012604 * cos (6.0 * M_PI * i / data_len));
-            }
+            apply_window (data,
+                plan->get_window (static_cast<WindowFunctions> (window_function)), windowed_data,
+                data_len);
             break;
         default:
             data_logger->error ("Invalid Window function. Window function:{}", window_function);
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *temp = new double[data_len];
-    try
+    double *temp = plan->temp.data ();
+    plan->fft.do_fft (temp, windowed_data);
+    for (int i = 0; i < data_len / 2 + 1; i++)
     {
-        ffft::FFTReal<double> fft_object (data_len);
-        fft_object.do_fft (temp, windowed_data);
-        for (int i = 0; i < data_len / 2 + 1; i++)
-        {
-            output_re[i] = temp[i];
-        }
-        output_im[0] = 0.0;
-        for (int count = 1, j = data_len / 2 + 1; j < data_len; j++, count++)
-        {
-            // add minus to make output exactly as in scipy
-            output_im[count] = -temp[j];
-        }
-        output_im[data_len / 2] = 0.0;
-        delete[] temp;
-        delete[] windowed_data;
-        windowed_data = NULL;
-        temp = NULL;
+        output_re[i] = temp[i];
     }
-    catch (const std::exception &e)
+    output_im[0] = 0.0;
+    for (int count = 1, j = data_len / 2 + 1; j < data_len; j++, count++)
     {
-        if (temp)
-        {
-            delete[] temp;
-        }
-        if (windowed_data)
-        {
-            delete[] windowed_data;
-        }
-        data_logger->error ("Error with doing FFT processing.");
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        // add minus to make output exactly as in scipy
+        output_im[count] = -temp[j];
     }
+    output_im[data_len / 2] = 0.0;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -629,33 +812,24 @@ int perform_ifft (double *input_re, double *input_im, int data_len, double *rest
                             "a postive power of 2.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *temp = new double[data_len];
-    try
-    {
-        ffft::FFTReal<double> fft_object (data_len);
-        for (int i = 0; i < data_len / 2 + 1; i++)
-        {
-            temp[i] = input_re[i];
-        }
-        for (int count = 1, j = data_len / 2 + 1; j < data_len; j++, count++)
-        {
-            // add minus to make output exactly as in scipy
-            temp[j] = -input_im[count];
-        }
-        fft_object.do_ifft (temp, restored_data);
-        fft_object.rescale (restored_data);
-        delete[] temp;
-        temp = NULL;
-    }
-    catch (const std::exception &e)
+    FFTPlan *plan = get_fft_plan (data_len);
+    if (plan == NULL)
     {
-        if (temp)
-        {
-            delete[] temp;
-        }
         data_logger->error ("Error with doing inverse FFT.");
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    double *temp = plan->temp.data ();
+    for (int i = 0; i < data_len / 2 + 1; i++)
+    {
+        temp[i] = input_re[i];
+    }
+    for (int count = 1, j = data_len / 2 + 1; j < data_len; j++, count++)
+    {
+        // add minus to make output exactly as in scipy
+        temp[j] = -input_im[count];
+    }
+    plan->fft.do_ifft (temp, restored_data);
+    plan->fft.rescale (restored_data);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -669,28 +843,30 @@ int get_psd (double *data, int data_len, int sampling_rate, int window_function,
                             "is >=1 and data_len is a postive power of 2.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *re = new double[data_len / 2 + 1];
-    double *im = new double[data_len / 2 + 1];
+    FFTPlan *plan = get_fft_plan (data_len);
+    if (plan == NULL)
+    {
+        data_logger->error ("Error with doing FFT processing.");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    double *re = plan->re.data ();
+    double *im = plan->im.data ();
     int res = perform_fft (data, data_len, window_function, re, im);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        delete[] re;
-        delete[] im;
         return res;
     }
+    // https://www.mathworks.com/help/signal/ug/power-spectral-density-estimates-using-fft.html
+    power_spectrum (re, im, output_ampl, data_len / 2 + 1, (double)(sampling_rate * data_len));
     double freq_res = (double)sampling_rate / (double)data_len;
     for (int i = 0; i < data_len / 2 + 1; i++)
     {
-        // https://www.mathworks.com/help/signal/ug/power-spectral-density-estimates-using-fft.html
-        output_ampl[i] = (re[i] * re[i] + im[i] * im[i]) / ((double)(sampling_rate * data_len));
         if ((i != 0) && (i != data_len / 2))
         {
             output_ampl[i] *= 2;
         }
         output_freq[i] = i * freq_res;
     }
-    delete[] re;
-    delete[] im;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -792,113 +968,102 @@ int read_file (double *data, int *num_rows, int *num_cols, char *file_name, int
         data_logger->error ("Nummber or elements must be greater than 0.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    FILE *fp;
-    fp = fopen (file_name, "r");
-    if (fp == NULL)
+    if ((data == NULL) || (num_rows == NULL) || (num_cols == NULL))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    CSVReader reader;
+    if (!reader.open (file_name))
     {
         data_logger->error ("Couldn't read file {}", file_name);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    char buf[4096];
     // rows and cols in csv file, in data array its transposed!
     int total_rows = 0;
     int total_cols = 0;
-
-    // count rows
-    char c;
-    for (c = getc (fp); c != EOF; c = getc (fp))
-    {
-        if (c == '\n')
+    // num_elements is from get_num_elements_in_file, so rows are not counted again, data is
+    // written with stride for max_rows and compacted if file has less rows
+    int max_rows = 0;
+    const char *line = NULL;
+    size_t line_len = 0;
+    while (reader.next_line (&line, &line_len))
+    {
+        if (total_rows == 0)
         {
-            total_rows++;
+            total_cols = CSVReader::count_fields (line, line_len);
+            max_rows = num_elements / total_cols;
+            if (max_rows == 0)
+            {
+                data_logger->error ("Number of elements {} is less than number of columns {}",
+                    num_elements, total_cols);
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
         }
-    }
-
-    fseek (fp, 0, SEEK_SET);
-    int current_row = 0;
-    int cur_pos = 0;
-    while (fgets (buf, sizeof (buf), fp) != NULL)
-    {
-        std::string csv_string (buf);
-        std::stringstream ss (csv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        while (getline (ss, tmp, ','))
+        if (!CSVReader::parse_line (line, line_len, data + total_rows, max_rows, total_cols))
         {
-            splitted.push_back (tmp);
+            data_logger->error ("Failed to parse line {} of file {}", total_rows + 1, file_name);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
-        total_cols = splitted.size ();
-        for (int i = 0; i < total_cols; i++)
+        total_rows++;
+        if (total_rows == max_rows)
         {
-            data[i * total_rows + current_row] = std::stod (splitted[i]);
-            cur_pos++;
-            if (cur_pos == (num_elements - 1))
-            {
-                *num_cols = current_row + 1;
-                *num_rows = total_cols;
-                fclose (fp);
-                return (int)BrainFlowExitCodes::STATUS_OK;
-            }
+            break;
+        }
+    }
+    if (total_rows == 0)
+    {
+        data_logger->error ("Empty file {}", file_name);
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    if (total_rows < max_rows)
+    {
+        for (int i = 1; i < total_cols; i++)
+        {
+            memmove (data + (size_t)i * total_rows, data + (size_t)i * max_rows,
+                sizeof (double) * total_rows);
         }
-        current_row++;
     }
-    // more likely code below is unreachable
     *num_cols = total_rows;
     *num_rows = total_cols;
-    fclose (fp);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int get_num_elements_in_file (char *file_name, int *num_elements)
 {
-    FILE *fp;
-    fp = fopen (file_name, "r");
-    if (fp == NULL)
+    if (num_elements == NULL)
+    {
+        data_logger->error ("num_elements cannot be NULL");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    CSVReader reader;
+    if (!reader.open (file_name))
     {
         data_logger->error ("Couldn't read file {}", file_name);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    char buf[4096];
     int total_rows = 0;
-
-    // count rows
-    char c;
-    for (c = getc (fp); c != EOF; c = getc (fp))
+    int total_cols = 0;
+    const char *line = NULL;
+    size_t line_len = 0;
+    while (reader.next_line (&line, &line_len))
     {
-        if (c == '\n')
+        if (total_rows == 0)
         {
-            total_rows++;
+            total_cols = CSVReader::count_fields (line, line_len);
         }
+        total_rows++;
     }
     if (total_rows == 0)
     {
         *num_elements = 0;
-        fclose (fp);
         data_logger->error ("Empty file {}", file_name);
         return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-
-    fseek (fp, 0, SEEK_SET);
-    while (fgets (buf, sizeof (buf), fp) != NULL)
-    {
-        std::string csv_string (buf);
-        std::stringstream ss (csv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        while (getline (ss, tmp, ','))
-        {
-            splitted.push_back (tmp);
-        }
-        *num_elements = splitted.size () * total_rows;
-        fclose (fp);
-        return (int)BrainFlowExitCodes::STATUS_OK;
-    }
-    *num_elements = 0;
-    fclose (fp);
-    data_logger->error ("File contents", file_name);
-    return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    *num_elements = total_rows * total_cols;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int detrend (double *data, int data_len, int detrend_operation)
@@ -968,7 +1133,7 @@ int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampli
         data_logger->error ("Please review your arguments.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *ampls = new double[nfft / 2 + 1];
+    std::vector<double> ampls (nfft / 2 + 1);
     int pos = 0;
     int counter = 0;
     for (int i = 0; i < nfft / 2 + 1; i++)
@@ -977,10 +1142,10 @@ int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampli
     }
     for (int pos = 0; (pos + nfft) < data_len; pos += (nfft - overlap), counter++)
     {
-        int res = get_psd (data + pos, nfft, sampling_rate, window_function, ampls, output_freq);
+        int res = get_psd (
+            data + pos, nfft, sampling_rate, window_function, ampls.data (), output_freq);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
-            delete[] ampls;
             return res;
         }
         for (int i = 0; i < nfft / 2 + 1; i++)
@@ -993,7 +1158,6 @@ int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampli
         data_logger->error ("Nfft must be less than data_len.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    delete[] ampls;
     // average data
     for (int i = 0; i < nfft / 2; i++)
     {
@@ -1003,6 +1167,31 @@ int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampli
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int get_psd_welch_multi (double *data, int rows, int cols, int *channels, int num_channels,
+    int nfft, int overlap, int sampling_rate, int window_function, double *output_ampl,
+    double *output_freq)
+{
+    if ((data == NULL) || (cols < 1) || (nfft < 1) || (output_ampl == NULL) ||
+        (output_freq == NULL) || (!validate_channels (rows, channels, num_channels)))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int psd_len = nfft / 2 + 1;
+    return process_channels (num_channels, [&] (int i) {
+        // frequencies are the same for all channels, other threads write them to scratch buffer
+        std::vector<double> freqs;
+        double *freq = output_freq;
+        if (i != 0)
+        {
+            freqs.resize (psd_len);
+            freq = freqs.data ();
+        }
+        return get_psd_welch (data + (size_t)channels[i] * cols, cols, nfft, overlap,
+            sampling_rate, window_function, output_ampl + (size_t)i * psd_len, freq);
+    });
+}
+
 int get_avg_band_powers (double *raw_data, int rows, int cols, int sampling_rate, int apply_filters,
     double *avg_band_powers, double *stddev_band_powers)
 {
@@ -1014,84 +1203,203 @@ int get_avg_band_powers (double *raw_data, int rows, int cols, int sampling_rate
     }
 
     // rows - channels, cols - datapoints
-    int *exit_codes = new int[rows];
+    int nfft = 0;
+    int res = get_band_powers_nfft (sampling_rate, cols, &nfft);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    std::vector<std::vector<double>> bands (5, std::vector<double> (rows, 0.0));
+    std::vector<int> exit_codes (rows, (int)BrainFlowExitCodes::STATUS_OK);
+    WorkerPool::get_instance ().parallel_for (rows, [&] (int i, WorkerScratch &scratch) {
+        exit_codes[i] = calc_band_powers (
+            raw_data, i, cols, nfft, sampling_rate, apply_filters, bands, scratch);
+    });
     for (int i = 0; i < rows; i++)
     {
-        exit_codes[i] = (int)BrainFlowExitCodes::STATUS_OK;
+        if (exit_codes[i] != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return exit_codes[i];
+        }
+    }
+
+    calc_avg_band_powers (bands, avg_band_powers, stddev_band_powers);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int create_band_power_tracker (int num_channels, int sampling_rate, int window_size,
+    int apply_filters, int *tracker_id)
+{
+    if ((num_channels < 1) || (sampling_rate < 1) || (window_size < 1) || (tracker_id == NULL))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
     int nfft = 0;
-    get_nearest_power_of_two (sampling_rate, &nfft);
-    nfft *= 2; // for resolution ~ 0.5
-    // handle the case if nfft > number of data points
-    // its valid case but results will not be accurate
-    while (nfft > cols)
+    int res = get_band_powers_nfft (sampling_rate, window_size, &nfft);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        nfft /= 2;
+        return res;
     }
-    if (nfft < 8)
+    BandPowerTracker *tracker = new BandPowerTracker (
+        num_channels, sampling_rate, nfft, window_size, apply_filters != 0);
+    res = tracker->prepare ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        data_logger->error ("Sampling rate argument issue..");
-        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+        delete tracker;
+        return res;
     }
-    double **bands = new double *[5];
-    for (int i = 0; i < 5; i++)
+    *tracker_id = band_power_trackers.add (tracker);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int add_band_power_tracker_data (int tracker_id, double *data, int rows, int cols)
+{
+    std::shared_ptr<BandPowerTracker> tracker = band_power_trackers.get (tracker_id);
+    if (!tracker)
     {
-        bands[i] = new double[rows];
-        // to make valgrind happy
-        for (int j = 0; j < rows; j++)
+        data_logger->error ("Band power tracker {} doesnt exist", tracker_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((data == NULL) || (cols < 0) || (rows != tracker->get_num_channels ()))
+    {
+        data_logger->error ("Data cannot be empty and rows must be equal to number of channels. "
+                            "Rows:{}, Channels:{}",
+            rows, tracker->get_num_channels ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return tracker->add_data (data, cols);
+}
+
+int get_band_power_tracker_values (
+    int tracker_id, double *avg_band_powers, double *stddev_band_powers)
+{
+    if ((avg_band_powers == NULL) || (stddev_band_powers == NULL))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<BandPowerTracker> tracker = band_power_trackers.get (tracker_id);
+    if (!tracker)
+    {
+        data_logger->error ("Band power tracker {} doesnt exist", tracker_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int rows = tracker->get_num_channels ();
+    int nfft = tracker->get_nfft ();
+    std::vector<double> ampls ((size_t)rows * (nfft / 2 + 1));
+    std::vector<double> freqs (nfft / 2 + 1);
+    int res = tracker->get_psd (ampls.data (), freqs.data ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Not enough data in band power tracker.");
+        return res;
+    }
+    std::vector<std::vector<double>> bands (5, std::vector<double> (rows, 0.0));
+    for (int i = 0; i < rows; i++)
+    {
+        res = calc_band_powers_from_psd (
+            ampls.data () + (size_t)i * (nfft / 2 + 1), freqs.data (), nfft, bands, i);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
-            bands[i][j] = 0.0;
+            return res;
         }
     }
+    calc_avg_band_powers (bands, avg_band_powers, stddev_band_powers);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    int num_threads = std::thread::hardware_concurrency ();
-    std::vector<std::thread> pool;
-    int rows_per_thread = rows / num_threads;
-    if (rows_per_thread == 0)
+int release_band_power_tracker (int tracker_id)
+{
+    if (!band_power_trackers.remove (tracker_id))
     {
-        rows_per_thread++;
+        data_logger->error ("Band power tracker {} doesnt exist", tracker_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    data_logger->trace (
-        "Use {} threads for calculation, {} channels per thread", num_threads, rows_per_thread);
-    for (int i = 0; i < num_threads; i++)
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+///////////////////////
+/////// Helpers ///////
+///////////////////////
+
+// ampls, freqs and filtered data are stored in scratch buffers of worker thread
+int calc_band_powers (double *raw_data, int row, int cols, int nfft, int sampling_rate,
+    int apply_filters, std::vector<std::vector<double>> &bands, WorkerScratch &scratch)
+{
+    double *ampls = scratch.get_buffer (0, nfft / 2 + 1);
+    double *freqs = scratch.get_buffer (1, nfft / 2 + 1);
+    double *thread_data = scratch.get_buffer (2, cols);
+    memcpy (thread_data, raw_data + (size_t)row * cols, sizeof (double) * cols);
+
+    int exit_code = (int)BrainFlowExitCodes::STATUS_OK;
+    if (apply_filters)
     {
-        int start_index = i * rows_per_thread;
-        int stop_index = (i + 1) * rows_per_thread;
-        if (i == num_threads - 1)
+        exit_code = detrend (thread_data, cols, (int)DetrendOperations::LINEAR);
+        if (exit_code == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            stop_index = rows;
+            exit_code = perform_bandstop (thread_data, cols, sampling_rate, 50.0, 4.0, 4,
+                (int)FilterTypes::BUTTERWORTH, 0.0);
         }
-        if (start_index >= rows)
+        if (exit_code == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            break;
+            exit_code = perform_bandstop (thread_data, cols, sampling_rate, 60.0, 4.0, 4,
+                (int)FilterTypes::BUTTERWORTH, 0.0);
         }
-        pool.push_back (std::thread (calc_per_channel_band_powers, raw_data, start_index,
-            stop_index, cols, nfft, sampling_rate, apply_filters, bands, exit_codes));
-    }
-    for (std::thread &th : pool)
-    {
-        if (th.joinable ())
+        if (exit_code == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            th.join ();
+            exit_code = perform_bandpass (thread_data, cols, sampling_rate, 24.0, 47.0, 4,
+                (int)FilterTypes::BUTTERWORTH, 0.0);
         }
     }
 
-    for (int i = 0; i < rows; i++)
+    // use 80% overlap, as long as it works fast overlap param can be big
+    exit_code = get_psd_welch (thread_data, cols, nfft, 4 * nfft / 5, sampling_rate,
+        (int)WindowFunctions::HANNING, ampls, freqs);
+    if (exit_code != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        if (exit_codes[i] != (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            int ec = exit_codes[i];
-            delete[] exit_codes;
-            for (int j = 0; j < 5; j++)
-            {
-                delete[] bands[j];
-            }
-            delete[] bands;
-            return ec;
-        }
+        return exit_code;
+    }
+    return calc_band_powers_from_psd (ampls, freqs, nfft, bands, row);
+}
+
+int calc_band_powers_from_psd (
+    double *ampls, double *freqs, int nfft, std::vector<std::vector<double>> &bands, int row)
+{
+    const double band_ranges[5][2] = {
+        {1.5, 4.0}, {4.0, 8.0}, {7.5, 13.0}, {13.0, 30.0}, {30.0, 45.0}};
+    int exit_code = (int)BrainFlowExitCodes::STATUS_OK;
+    for (int i = 0; (i < 5) && (exit_code == (int)BrainFlowExitCodes::STATUS_OK); i++)
+    {
+        exit_code = get_band_power (ampls, freqs, nfft / 2 + 1, band_ranges[i][0],
+            band_ranges[i][1], &bands[i][row]);
+    }
+    return exit_code;
+}
+
+int get_band_powers_nfft (int sampling_rate, int cols, int *nfft)
+{
+    get_nearest_power_of_two (sampling_rate, nfft);
+    *nfft *= 2; // for resolution ~ 0.5
+    // handle the case if nfft > number of data points
+    // its valid case but results will not be accurate
+    while (*nfft > cols)
+    {
+        *nfft /= 2;
+    }
+    if (*nfft < 8)
+    {
+        data_logger->error ("Sampling rate argument issue..");
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    // find average and stddev
+// bands has 5 rows and a column per channel
+void calc_avg_band_powers (
+    std::vector<std::vector<double>> &bands, double *avg_band_powers, double *stddev_band_powers)
+{
+    int rows = (int)bands[0].size ();
     double avg_bands[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
     double std_bands[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
     for (int i = 0; i < 5; i++)
@@ -1122,77 +1430,4 @@ int get_avg_band_powers (double *raw_data, int rows, int cols, int sampling_rate
         // lose information about ratio between mean and deviation
         stddev_band_powers[i] = std_bands[i] / avg_bands[i];
     }
-
-    delete[] exit_codes;
-    for (int j = 0; j < 5; j++)
-    {
-        delete[] bands[j];
-    }
-    delete[] bands;
-
-    return (int)BrainFlowExitCodes::STATUS_OK;
 }
-
-///////////////////////
-/////// Helpers ///////
-///////////////////////
-
-void calc_per_channel_band_powers (double *raw_data, int row_num_start, int row_num_stop, int cols,
-    int nfft, int sampling_rate, int aply_filters, double **bands, int *exit_codes)
-{
-    for (int i = row_num_start; i < row_num_stop; i++)
-    {
-        double *ampls = new double[nfft / 2 + 1];
-        double *freqs = new double[nfft / 2 + 1];
-        double *thread_data = new double[cols];
-        memcpy (thread_data, raw_data + i * cols, sizeof (double) * cols);
-
-        if (aply_filters)
-        {
-            exit_codes[i] = detrend (thread_data, cols, (int)DetrendOperations::LINEAR);
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-            {
-                exit_codes[i] = perform_bandstop (thread_data, cols, sampling_rate, 50.0, 4.0, 4,
-                    (int)FilterTypes::BUTTERWORTH, 0.0);
-            }
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-            {
-                exit_codes[i] = perform_bandstop (thread_data, cols, sampling_rate, 60.0, 4.0, 4,
-                    (int)FilterTypes::BUTTERWORTH, 0.0);
-            }
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-            {
-                exit_codes[i] = perform_bandpass (thread_data, cols, sampling_rate, 24.0, 47.0, 4,
-                    (int)FilterTypes::BUTTERWORTH, 0.0);
-            }
-        }
-
-        // use 80% overlap, as long as it works fast overlap param can be big
-        exit_codes[i] = get_psd_welch (thread_data, cols, nfft, 4 * nfft / 5, sampling_rate,
-            (int)WindowFunctions::HANNING, ampls, freqs);
-        if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            exit_codes[i] = get_band_power (ampls, freqs, nfft / 2 + 1, 1.5, 4.0, &bands[0][i]);
-        }
-        if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            exit_codes[i] = get_band_power (ampls, freqs, nfft / 2 + 1, 4.0, 8.0, &bands[1][i]);
-        }
-        if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            exit_codes[i] = get_band_power (ampls, freqs, nfft / 2 + 1, 7.5, 13.0, &bands[2][i]);
-        }
-        if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            exit_codes[i] = get_band_power (ampls, freqs, nfft / 2 + 1, 13.0, 30.0, &bands[3][i]);
-        }
-        if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            exit_codes[i] = get_band_power (ampls, freqs, nfft / 2 + 1, 30.0, 45.0, &bands[4][i]);
-        }
-
-        delete[] ampls;
-        delete[] freqs;
-        delete[] thread_data;
-    }
-}
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "dsp_kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DSP_KERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// msvc allows intrinsics for any instruction set without compiler flags
+#define TARGET_AVX2
+#define TARGET_SSE2
+#else
+#define TARGET_AVX2 __attribute__ ((target ("avx2")))
+#define TARGET_SSE2 __attribute__ ((target ("sse2")))
+#endif
+#endif
+
+
+//////////////////////////
+///////// Scalar /////////
+//////////////////////////
+
+static void apply_window_scalar (const double *data, const double *window, double *output, int len)
+{
+    for (int i = 0; i < len; i++)
+    {
+        output[i] = data[i] * window[i];
+    }
+}
+
+static void power_spectrum_scalar (
+    const double *re, const double *im, double *output, int len, double divider)
+{
+    for (int i = 0; i < len; i++)
+    {
+        output[i] = (re[i] * re[i] + im[i] * im[i]) / divider;
+    }
+}
+
+#ifdef DSP_KERNELS_X86
+
+//////////////////////////
+////////// SSE2 //////////
+//////////////////////////
+
+TARGET_SSE2 static void apply_window_sse2 (
+    const double *data, const double *window, double *output, int len)
+{
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        __m128d x = _mm_loadu_pd (data + i);
+        __m128d w = _mm_loadu_pd (window + i);
+        _mm_storeu_pd (output + i, _mm_mul_pd (x, w));
+    }
+    apply_window_scalar (data + i, window + i, output + i, len - i);
+}
+
+TARGET_SSE2 static void power_spectrum_sse2 (
+    const double *re, const double *im, double *output, int len, double divider)
+{
+    __m128d d = _mm_set1_pd (divider);
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        __m128d r = _mm_loadu_pd (re + i);
+        __m128d m = _mm_loadu_pd (im + i);
+        __m128d p = _mm_add_pd (_mm_mul_pd (r, r), _mm_mul_pd (m, m));
+        _mm_storeu_pd (output + i, _mm_div_pd (p, d));
+    }
+    power_spectrum_scalar (re + i, im + i, output + i, len - i, divider);
+}
+
+//////////////////////////
+////////// AVX2 //////////
+//////////////////////////
+
+// no fma here to get the same rounding as in scalar version
+TARGET_AVX2 static void apply_window_avx2 (
+    const double *data, const double *window, double *output, int len)
+{
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        __m256d x = _mm256_loadu_pd (data + i);
+        __m256d w = _mm256_loadu_pd (window + i);
+        _mm256_storeu_pd (output + i, _mm256_mul_pd (x, w));
+    }
+    apply_window_scalar (data + i, window + i, output + i, len - i);
+}
+
+TARGET_AVX2 static void power_spectrum_avx2 (
+    const double *re, const double *im, double *output, int len, double divider)
+{
+    __m256d d = _mm256_set1_pd (divider);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        __m256d r = _mm256_loadu_pd (re + i);
+        __m256d m = _mm256_loadu_pd (im + i);
+        __m256d p = _mm256_add_pd (_mm256_mul_pd (r, r), _mm256_mul_pd (m, m));
+        _mm256_storeu_pd (output + i, _mm256_div_pd (p, d));
+    }
+    power_spectrum_scalar (re + i, im + i, output + i, len - i, divider);
+}
+
+static bool cpu_supports_avx2 ()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid (info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+    __cpuid (info, 1);
+    // os must save ymm registers(osxsave + avx bits, and xcr0 check)
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if ((!osxsave) || (!avx) || ((_xgetbv (0) & 6) != 6))
+    {
+        return false;
+    }
+    __cpuidex (info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ("avx2") != 0;
+#endif
+}
+
+static bool cpu_supports_sse2 ()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return true;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid (info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ("sse2") != 0;
+#endif
+}
+
+#endif
+
+//////////////////////////
+//////// Dispatch ////////
+//////////////////////////
+
+struct DspKernels
+{
+    void (*apply_window) (const double *, const double *, double *, int);
+    void (*power_spectrum) (const double *, const double *, double *, int, double);
+
+    DspKernels ()
+    {
+        apply_window = apply_window_scalar;
+        power_spectrum = power_spectrum_scalar;
+#ifdef DSP_KERNELS_X86
+        if (cpu_supports_avx2 ())
+        {
+            apply_window = apply_window_avx2;
+            power_spectrum = power_spectrum_avx2;
+        }
+        else if (cpu_supports_sse2 ())
+        {
+            apply_window = apply_window_sse2;
+            power_spectrum = power_spectrum_sse2;
+        }
+#endif
+    }
+};
+
+// initialization of function local static is thread safe
+static const DspKernels &get_kernels ()
+{
+    static const DspKernels kernels;
+    return kernels;
+}
+
+void apply_window (const double *data, const double *window, double *output, int len)
+{
+    get_kernels ().apply_window (data, window, output, len);
+}
+
+void power_spectrum (const double *re, const double *im, double *output, int len, double divider)
+{
+    get_kernels ().power_spectrum (re, im, output, len, divider);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "worker_pool.h"
+
+
+// keeps psd of welch segments for the latest window of several channels, new samples are
+// transformed only once when segment is complete and expired segments are dropped.
+// Segments start at multiples of step from the first added sample, if window start is aligned
+// to them result is exactly the same as get_psd_welch for this window
+class BandPowerTracker
+{
+public:
+    BandPowerTracker (
+        int num_channels, int sampling_rate, int nfft, int window_size, bool apply_filters);
+    ~BandPowerTracker ();
+
+    // creates filters, should be called before other methods
+    int prepare ();
+    // data is a matrix with num_channels rows and num_samples cols
+    int add_data (double *data, int num_samples);
+    // writes averaged psd for all channels(num_channels rows and nfft / 2 + 1 cols) and freqs
+    int get_psd (double *ampls, double *freqs);
+
+    int get_num_channels ()
+    {
+        return num_channels;
+    }
+
+    int get_nfft ()
+    {
+        return nfft;
+    }
+
+private:
+    struct ChannelState
+    {
+        std::vector<double> pending; // samples which are not used in complete segments yet
+        std::vector<double> segments; // ring with psd of num_segments latest segments
+        std::vector<int> filter_ids;
+    };
+
+    int num_channels;
+    int sampling_rate;
+    int nfft;
+    int step;
+    int psd_len;
+    int num_segments;
+    bool apply_filters;
+    long long segments_count;
+    std::vector<ChannelState> channels;
+    std::mutex m;
+
+    int add_channel_data (
+        int channel, double *data, int num_samples, int new_segments, WorkerScratch &scratch);
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdio.h>
+#include <vector>
+
+
+// reads csv files with numbers written by write_file, file is read in large blocks and lines can
+// be of any length. Numbers are parsed without temporary strings and streams
+class CSVReader
+{
+public:
+    CSVReader ();
+    ~CSVReader ();
+
+    bool open (const char *file_name);
+    // returns false at the end of file, line doesnt include line ending and is not null terminated,
+    // it's valid only until the next call. Blank lines are skipped
+    bool next_line (const char **line, size_t *line_len);
+
+    // returns number of comma separated fields in line
+    static int count_fields (const char *line, size_t line_len);
+    // parses exactly num_values comma separated numbers, i-th number is written to values[i * stride]
+    static bool parse_line (
+        const char *line, size_t line_len, double *values, size_t stride, int num_values);
+    // parses number from [begin, end), surrounding whitespace is allowed
+    static bool parse_number (const char *begin, const char *end, double *value);
+
+private:
+    FILE *fp;
+    std::vector<char> buffer;
+    size_t pos; // start of unprocessed data in buffer
+    size_t len; // end of data in buffer
+    bool eof;
+
+    bool read_block ();
+    static bool parse_number_slow (const char *begin, const char *end, double *value);
+};
@@ -18,12 +18,42 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION perform_bandstop (double *data, int data_len,
         int sampling_rate, double center_freq, double band_width, int order, int filter_type,
         double ripple);
+    // the same filters for several rows of row-major data matrix, rows are processed in parallel
+    SHARED_EXPORT int CALLING_CONVENTION perform_lowpass_multi (double *data, int rows, int cols,
+        int *channels, int num_channels, int sampling_rate, double cutoff, int order,
+        int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION perform_highpass_multi (double *data, int rows, int cols,
+        int *channels, int num_channels, int sampling_rate, double cutoff, int order,
+        int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION perform_bandpass_multi (double *data, int rows, int cols,
+        int *channels, int num_channels, int sampling_rate, double center_freq, double band_width,
+        int order, int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION perform_bandstop_multi (double *data, int rows, int cols,
+        int *channels, int num_channels, int sampling_rate, double center_freq, double band_width,
+        int order, int filter_type, double ripple);
+    // filters which keep their state between calls, use them to filter data chunk by chunk
+    SHARED_EXPORT int CALLING_CONVENTION create_filter (int filter_operation, int sampling_rate,
+        double freq, double band_width, int order, int filter_type, double ripple, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION process_filter (int filter_id, double *data, int data_len);
+    SHARED_EXPORT int CALLING_CONVENTION release_filter (int filter_id);
 
     SHARED_EXPORT int CALLING_CONVENTION perform_rolling_filter (
         double *data, int data_len, int period, int agg_operation);
+    // rolling filter which keeps its window between calls, only mean and median are supported
+    SHARED_EXPORT int CALLING_CONVENTION create_rolling_filter (
+        int period, int agg_operation, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION process_rolling_filter (
+        int filter_id, double *data, int data_len);
+    SHARED_EXPORT int CALLING_CONVENTION release_rolling_filter (int filter_id);
 
     SHARED_EXPORT int CALLING_CONVENTION perform_downsampling (
         double *data, int data_len, int period, int agg_operation, double *output_data);
+    // converts signal between sampling rates with polyphase filter, use get_resampled_len to get
+    // size of output_data
+    SHARED_EXPORT int CALLING_CONVENTION get_resampled_len (
+        int data_len, int input_rate, int output_rate, int *output_len);
+    SHARED_EXPORT int CALLING_CONVENTION perform_resampling (
+        double *data, int data_len, int input_rate, int output_rate, double *output_data);
 
     SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_transform (double *data, int data_len,
         char *wavelet, int decomposition_level, double *output_data, int *decomposition_lengths);
@@ -32,6 +62,9 @@ extern "C"
         double *output_data);
     SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_denoising (
         double *data, int data_len, char *wavelet, int decomposition_level);
+    // denoises selected rows of data table in parallel, data is rows x cols and modified in place
+    SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_denoising_multi (double *data, int rows,
+        int cols, int *channels, int num_channels, char *wavelet, int decomposition_level);
     SHARED_EXPORT int CALLING_CONVENTION perform_fft (
         double *data, int data_len, int window_function, double *output_re, double *output_im);
     SHARED_EXPORT int CALLING_CONVENTION perform_ifft (
@@ -44,14 +77,30 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION get_psd_welch (double *data, int data_len, int nfft,
         int overlap, int sampling_rate, int window_function, double *output_ampl,
         double *output_freq);
+    // output_ampl is a matrix with num_channels rows and nfft / 2 + 1 cols
+    SHARED_EXPORT int CALLING_CONVENTION get_psd_welch_multi (double *data, int rows, int cols,
+        int *channels, int num_channels, int nfft, int overlap, int sampling_rate,
+        int window_function, double *output_ampl, double *output_freq);
     SHARED_EXPORT int CALLING_CONVENTION get_band_power (double *ampl, double *freq, int data_len,
         double freq_start, double freq_end, double *band_power);
 
     SHARED_EXPORT int CALLING_CONVENTION get_avg_band_powers (double *raw_data, int rows, int cols,
         int sampling_rate, int apply_filters, double *avg_band_powers, double *stddev_band_powers);
+    // calculates the same band powers as get_avg_band_powers for the latest window_size samples
+    // but transforms each new welch segment only once, data is a matrix with rows = num_channels
+    SHARED_EXPORT int CALLING_CONVENTION create_band_power_tracker (int num_channels,
+        int sampling_rate, int window_size, int apply_filters, int *tracker_id);
+    SHARED_EXPORT int CALLING_CONVENTION add_band_power_tracker_data (
+        int tracker_id, double *data, int rows, int cols);
+    SHARED_EXPORT int CALLING_CONVENTION get_band_power_tracker_values (
+        int tracker_id, double *avg_band_powers, double *stddev_band_powers);
+    SHARED_EXPORT int CALLING_CONVENTION release_band_power_tracker (int tracker_id);
     // logging methods
     SHARED_EXPORT int CALLING_CONVENTION set_log_level (int log_level);
     SHARED_EXPORT int CALLING_CONVENTION set_log_file (char *log_file);
+    // size of thread pool used by multichannel methods including calling thread, by default it's
+    // number of cores or value of BRAINFLOW_NUM_THREADS env variable
+    SHARED_EXPORT int CALLING_CONVENTION set_num_threads (int num_threads);
     // file operations
     SHARED_EXPORT int CALLING_CONVENTION write_file (
         double *data, int num_rows, int num_cols, char *file_name, char *file_mode);
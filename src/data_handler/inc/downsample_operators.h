@@ -24,11 +24,7 @@ inline double downsample_median (double *data, int len)
     {
         return downsample_mean (data, len);
     }
-    std::vector<double> values;
-    for (int i = 0; i < len; i++)
-    {
-        values.push_back (data[i]);
-    }
-    std::sort (values.begin (), values.end ());
+    std::vector<double> values (data, data + len);
+    std::nth_element (values.begin (), values.begin () + len / 2, values.end ());
     return values[len / 2];
 }
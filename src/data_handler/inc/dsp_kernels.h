@@ -0,0 +1,10 @@
+#pragma once
+
+
+// vectorized loops used in spectral methods, implementation(avx2, sse2 or scalar) is selected once
+// in runtime according to cpu features, all implementations return exactly the same results
+
+// output[i] = data[i] * window[i]
+void apply_window (const double *data, const double *window, double *output, int len);
+// output[i] = (re[i] * re[i] + im[i] * im[i]) / divider
+void power_spectrum (const double *re, const double *im, double *output, int len, double divider);
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <map>
+#include <math.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "brainflow_constants.h"
+
+#include "FFTReal.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+
+// FFTReal computes bit reversal and twiddle tables in constructor, plan keeps it together with
+// work buffers to reuse them for all transforms of the same size
+struct FFTPlan
+{
+    ffft::FFTReal<double> fft;
+    std::vector<double> windowed_data;
+    std::vector<double> temp;
+    // spectrum buffers for methods which dont return complex spectrum(psd)
+    std::vector<double> re;
+    std::vector<double> im;
+    // window coefficients for this size, index is window function
+    std::vector<double> windows[4];
+
+    explicit FFTPlan (int data_len)
+        : fft (data_len),
+          windowed_data (data_len),
+          temp (data_len),
+          re (data_len / 2 + 1),
+          im (data_len / 2 + 1)
+    {
+    }
+
+    // calculates window on first use, supports all WindowFunctions except NO_WINDOW
+    const double *get_window (WindowFunctions window_function)
+    {
+        std::vector<double> &window = windows[(int)window_function];
+        if (!window.empty ())
+        {
+            return window.data ();
+        }
+        int data_len = (int)temp.size ();
+        window.resize (data_len);
+        // from https://www.edn.com/windowing-functions-improve-fft-results-part-i/
+        for (int i = 0; i < data_len; i++)
+        {
+            switch (window_function)
+            {
+                case WindowFunctions::HAMMING:
+                    window[i] = 0.54 - 0.46 * cos (2.0 * M_PI * i / data_len);
+                    break;
+                case WindowFunctions::HANNING:
+                    window[i] = 0.5 - 0.5 * cos (2.0 * M_PI * i / data_len);
+                    break;
+                case WindowFunctions::BLACKMAN_HARRIS:
+                    window[i] = 0.355768 - 0.487396 * cos (2.0 * M_PI * i / data_len) +
+                        0.144232 * cos (4.0 * M_PI * i / data_len) -
+                        0.012604 * cos (6.0 * M_PI * i / data_len);
+                    break;
+                default:
+                    window[i] = 1.0;
+                    break;
+            }
+        }
+        return window.data ();
+    }
+};
+
+// FFTReal uses internal buffer during transform and can not be shared between threads, so each
+// thread has its own cache, data_len is a power of 2 so there are at most 31 plans per thread,
+// returns NULL if plan can not be created
+inline FFTPlan *get_fft_plan (int data_len)
+{
+    static thread_local std::map<int, std::unique_ptr<FFTPlan>> plans;
+    auto it = plans.find (data_len);
+    if (it != plans.end ())
+    {
+        return it->second.get ();
+    }
+    try
+    {
+        FFTPlan *plan = new FFTPlan (data_len);
+        plans[data_len] = std::unique_ptr<FFTPlan> (plan);
+        return plan;
+    }
+    catch (const std::exception &e)
+    {
+        return NULL;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+
+// stores objects which keep state between calls(filters, trackers) and gives integer ids for
+// them to use in C API, lock is held only to find/add/remove an object, calls for different ids
+// dont block each other, but the same id should not be used from several threads simultaneously
+template <typename T> class HandleRegistry
+{
+public:
+    HandleRegistry ()
+    {
+        next_id = 0;
+    }
+
+    // takes ownership of object
+    int add (T *object)
+    {
+        std::lock_guard<std::mutex> lock (m);
+        int id = next_id++;
+        objects[id] = std::shared_ptr<T> (object);
+        return id;
+    }
+
+    // returns NULL for unknown id, object stays alive until returned pointer is destroyed even if
+    // it was removed from registry
+    std::shared_ptr<T> get (int id)
+    {
+        std::lock_guard<std::mutex> lock (m);
+        auto it = objects.find (id);
+        if (it == objects.end ())
+        {
+            return std::shared_ptr<T> ();
+        }
+        return it->second;
+    }
+
+    bool remove (int id)
+    {
+        std::lock_guard<std::mutex> lock (m);
+        return objects.erase (id) > 0;
+    }
+
+private:
+    std::mutex m;
+    std::map<int, std::shared_ptr<T>> objects;
+    int next_id;
+};
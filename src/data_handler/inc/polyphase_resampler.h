@@ -0,0 +1,87 @@
+#pragma once
+
+#include <math.h>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+
+// changes sampling rate by up / down with windowed sinc lowpass filter, only taps which hit
+// nonzero samples of upsampled signal are used and only output samples are calculated, so cost
+// is num_outputs * num_taps / up. Output sample m is aligned with input time m * down / up(no
+// delay), input is extended with edge values to avoid transients at the edges
+class PolyphaseResampler
+{
+public:
+    PolyphaseResampler (int up, int down)
+    {
+        this->up = up;
+        this->down = down;
+        int factor = (up > down) ? up : down;
+        // the same filter length and cutoff as scipy's decimate and resample_poly
+        int half_len = 10 * factor;
+        int num_taps = 2 * half_len + 1;
+        double cutoff = 0.5 / factor; // cycles per sample of upsampled signal
+        taps.resize (num_taps);
+        for (int k = 0; k < num_taps; k++)
+        {
+            double x = 2.0 * M_PI * cutoff * (k - half_len);
+            double sinc = (k == half_len) ? 1.0 : sin (x) / x;
+            double window = 0.54 - 0.46 * cos (2.0 * M_PI * k / (num_taps - 1));
+            taps[k] = sinc * window;
+        }
+        // each output uses taps of a single phase, normalize them separately to keep constant
+        // signal unchanged for all outputs
+        for (int phase = 0; phase < up; phase++)
+        {
+            double sum = 0.0;
+            for (int k = phase; k < num_taps; k += up)
+            {
+                sum += taps[k];
+            }
+            for (int k = phase; k < num_taps; k += up)
+            {
+                taps[k] /= sum;
+            }
+        }
+    }
+
+    // number of output samples for data_len input samples
+    long long get_output_len (int data_len)
+    {
+        return ((long long)data_len * up + down - 1) / down;
+    }
+
+    void process (const double *data, int data_len, double *output, long long output_len)
+    {
+        int num_taps = (int)taps.size ();
+        long long delay = num_taps / 2;
+        for (long long m = 0; m < output_len; m++)
+        {
+            // index in upsampled signal which is multiplied by taps[0]
+            long long t = m * down + delay;
+            double sum = 0.0;
+            for (long long k = t % up; k < num_taps; k += up)
+            {
+                long long j = (t - k) / up;
+                if (j < 0)
+                {
+                    j = 0;
+                }
+                else if (j >= data_len)
+                {
+                    j = data_len - 1;
+                }
+                sum += taps[k] * data[j];
+            }
+            output[m] = sum;
+        }
+    }
+
+private:
+    int up;
+    int down;
+    std::vector<double> taps;
+};
@@ -1,7 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <deque>
-#include <set>
+#include <vector>
 
 template <typename T> class RollingFilter
 {
@@ -23,42 +24,154 @@ public:
     virtual T get_value () = 0;
 };
 
+// window is stored in ring buffer, lower half of window is in max heap and upper half is in min
+// heap, heaps keep ring positions and each position knows its place in heap, so the oldest value
+// is replaced in O(log n) without searching and memory allocations
 template <typename T> class RollingMedian : public RollingFilter<T>
 {
 
 private:
-    std::multiset<T> dataset;
-    std::deque<T> deque;
+    std::vector<T> values;     // ring buffer with window
+    std::vector<int> low;      // max heap with positions of the lower half
+    std::vector<int> high;     // min heap with positions of the upper half
+    std::vector<int> heap_pos; // index in low(>= 0) or high(< 0, ~index) for each position
+    int count;
+    int oldest;
+
+    // for max heap a should be above b if it's bigger, for min heap if it's smaller
+    bool is_above (bool is_low, int a, int b)
+    {
+        return is_low ? (values[a] > values[b]) : (values[a] < values[b]);
+    }
+
+    void set (bool is_low, int index, int pos)
+    {
+        std::vector<int> &heap = is_low ? low : high;
+        heap[index] = pos;
+        heap_pos[pos] = is_low ? index : ~index;
+    }
+
+    void sift_up (bool is_low, int index)
+    {
+        std::vector<int> &heap = is_low ? low : high;
+        int pos = heap[index];
+        while (index > 0)
+        {
+            int parent = (index - 1) / 2;
+            if (!is_above (is_low, pos, heap[parent]))
+            {
+                break;
+            }
+            set (is_low, index, heap[parent]);
+            index = parent;
+        }
+        set (is_low, index, pos);
+    }
+
+    void sift_down (bool is_low, int index)
+    {
+        std::vector<int> &heap = is_low ? low : high;
+        int size = (int)heap.size ();
+        int pos = heap[index];
+        while (true)
+        {
+            int child = 2 * index + 1;
+            if (child >= size)
+            {
+                break;
+            }
+            if ((child + 1 < size) && (is_above (is_low, heap[child + 1], heap[child])))
+            {
+                child++;
+            }
+            if (!is_above (is_low, heap[child], pos))
+            {
+                break;
+            }
+            set (is_low, index, heap[child]);
+            index = child;
+        }
+        set (is_low, index, pos);
+    }
+
+    // sorted window goes to heaps: sorted array is a valid heap
+    void build_heaps ()
+    {
+        std::vector<int> order (this->period);
+        for (int i = 0; i < this->period; i++)
+        {
+            order[i] = i;
+        }
+        std::sort (order.begin (), order.end (),
+            [this] (int a, int b) { return values[a] < values[b]; });
+        int low_size = (this->period + 1) / 2;
+        low.resize (low_size);
+        high.resize (this->period - low_size);
+        for (int i = 0; i < low_size; i++)
+        {
+            set (true, i, order[low_size - 1 - i]);
+        }
+        for (int i = low_size; i < this->period; i++)
+        {
+            set (false, i - low_size, order[i]);
+        }
+    }
+
+    void replace_oldest (T num)
+    {
+        int pos = oldest;
+        values[pos] = num;
+        bool is_low = heap_pos[pos] >= 0;
+        int index = is_low ? heap_pos[pos] : ~heap_pos[pos];
+        sift_up (is_low, index);
+        index = is_low ? heap_pos[pos] : ~heap_pos[pos];
+        sift_down (is_low, index);
+        // only one value changed, so single exchange of tops restores the order between halves
+        if ((!high.empty ()) && (values[low[0]] > values[high[0]]))
+        {
+            int low_top = low[0];
+            set (true, 0, high[0]);
+            set (false, 0, low_top);
+            sift_down (true, 0);
+            sift_down (false, 0);
+        }
+    }
 
 public:
-    RollingMedian (int period) : RollingFilter<T> (period)
+    RollingMedian (int period)
+        : RollingFilter<T> (period), values (period), heap_pos (period), count (0), oldest (0)
     {
     }
 
     void add_data (T num)
     {
-        this->deque.push_back (num);
-        this->dataset.insert (num);
+        if (count < this->period)
+        {
+            values[count++] = num;
+            if (count == this->period)
+            {
+                build_heaps ();
+            }
+        }
+        else
+        {
+            replace_oldest (num);
+            oldest = (oldest + 1) % this->period;
+        }
     }
 
-    // https://leetcode.com/problems/sliding-window-median/
     T get_value ()
     {
-        if (this->dataset.size () < this->period)
+        if (count < this->period)
         {
             // to simplify algorithm if there are less data just return the last value
-            return this->deque.back ();
+            return values[count - 1];
+        }
+        if ((this->period & 1) == 1)
+        {
+            return values[low[0]];
         }
-        auto it1 = this->dataset.begin ();
-        auto it2 = it1;
-        std::advance (it1, (this->period - 1) / 2);
-        it2 = it1;
-        std::advance (it2, (int)((this->period & 1) == 0));
-        T res = (*it1 + *it2) / 2.0;
-        T val = deque.front ();
-        deque.pop_front ();
-        this->dataset.erase (this->dataset.find (val));
-        return res;
+        return (values[low[0]] + values[high[0]]) / 2.0;
     }
 };
 
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <math.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "wavelib.h"
+
+// max number of plans per thread, unlike fft sizes data length is arbitrary so cache is bounded
+#define MAX_WAVELET_PLANS 32
+
+
+// wave_init and wt_init allocate filters and output buffer on each call, plan keeps them for
+// (wavelet, data_len, decomposition_level) to reuse in transforms and denoising. Settings are the
+// same as in all wavelet methods: dwt with symmetric extension and direct convolution
+struct WaveletPlan
+{
+    wave_object wave;
+    wt_object wt;
+    // buffer for noise estimation in denoising
+    std::vector<double> temp;
+
+    WaveletPlan (const char *wavelet, int data_len, int decomposition_level)
+        : wave (NULL), wt (NULL), temp (data_len)
+    {
+        wave = wave_init (wavelet);
+        try
+        {
+            // throws if data_len is too small for this wavelet and level
+            wt = wt_init (wave, "dwt", data_len, decomposition_level);
+        }
+        catch (...)
+        {
+            wave_free (wave);
+            throw;
+        }
+        setDWTExtension (wt, "sym");
+        setWTConv (wt, "direct");
+    }
+
+    ~WaveletPlan ()
+    {
+        wt_free (wt);
+        wave_free (wave);
+    }
+
+    WaveletPlan (const WaveletPlan &) = delete;
+    WaveletPlan &operator= (const WaveletPlan &) = delete;
+
+    // the same as visushrink from wavelib with dwt, soft thresholding and noise estimation for
+    // all levels, but without reinitialization of wavelet objects, denoises data in place
+    void denoise (double *data)
+    {
+        dwt (wt, data);
+        int levels = wt->J;
+        double threshold_scale = sqrt (2.0 * log ((double)wt->outlength));
+        int offset = wt->length[0];
+        for (int level = 0; level < levels; level++)
+        {
+            int len = wt->length[level + 1];
+            double *coeffs = wt->output + offset;
+            for (int i = 0; i < len; i++)
+            {
+                temp[i] = fabs (coeffs[i]);
+            }
+            double threshold = threshold_scale * (get_median (temp.data (), len) / 0.6745);
+            for (int i = 0; i < len; i++)
+            {
+                if (fabs (coeffs[i]) < threshold)
+                {
+                    coeffs[i] = 0.0;
+                }
+                else
+                {
+                    coeffs[i] = (coeffs[i] >= 0) ? fabs (coeffs[i]) - threshold
+                                                 : -(fabs (coeffs[i]) - threshold);
+                }
+            }
+            offset += len;
+        }
+        idwt (wt, data);
+    }
+
+private:
+    // reorders values
+    static double get_median (double *values, int len)
+    {
+        std::nth_element (values, values + len / 2, values + len);
+        double median = values[len / 2];
+        if ((len % 2) == 0)
+        {
+            median = (*std::max_element (values, values + len / 2) + median) / 2.0;
+        }
+        return median;
+    }
+};
+
+// wavelib objects can not be shared between threads, so each thread has its own cache, returns
+// NULL if plan can not be created(likely data_len is too small)
+inline WaveletPlan *get_wavelet_plan (const char *wavelet, int data_len, int decomposition_level)
+{
+    typedef std::tuple<std::string, int, int> PlanKey;
+    static thread_local std::map<PlanKey, std::unique_ptr<WaveletPlan>> plans;
+    PlanKey key (wavelet, data_len, decomposition_level);
+    auto it = plans.find (key);
+    if (it != plans.end ())
+    {
+        return it->second.get ();
+    }
+    if (plans.size () >= MAX_WAVELET_PLANS)
+    {
+        plans.clear ();
+    }
+    try
+    {
+        WaveletPlan *plan = new WaveletPlan (wavelet, data_len, decomposition_level);
+        plans[key] = std::unique_ptr<WaveletPlan> (plan);
+        return plan;
+    }
+    catch (const std::exception &e)
+    {
+        return NULL;
+    }
+}
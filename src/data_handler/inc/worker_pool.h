@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stddef.h>
+#include <thread>
+#include <vector>
+
+
+// buffers reused by all tasks which run in the same thread, task should not keep pointers to them
+class WorkerScratch
+{
+public:
+    static const int max_buffers = 4;
+
+    // returns buffer with at least size elements, content is undefined
+    double *get_buffer (int buffer_id, size_t size)
+    {
+        std::vector<double> &buffer = buffers[buffer_id];
+        if (buffer.size () < size)
+        {
+            buffer.resize (size);
+        }
+        return buffer.data ();
+    }
+
+private:
+    std::vector<double> buffers[max_buffers];
+};
+
+// process wide pool used for parallel signal processing, threads are started on first use.
+// Calling thread executes tasks too, idle threads take the next task of any running parallel_for,
+// so a call is never blocked by slow tasks of another call
+class WorkerPool
+{
+public:
+    typedef std::function<void (int, WorkerScratch &)> Task;
+
+    static WorkerPool &get_instance ();
+
+    // runs task (i, scratch) for i in 0..num_tasks - 1 and waits for all of them, calls from
+    // worker threads are executed sequentially in the calling thread
+    void parallel_for (int num_tasks, const Task &task);
+    // total number of threads including calling thread, 1 disables parallel execution
+    bool set_num_threads (int num_threads);
+    int get_num_threads ();
+
+private:
+    struct Job
+    {
+        const Task *task;
+        int num_tasks;
+        std::atomic<int> next_task;
+        int active_workers; // guarded by mutex
+
+        Job (const Task *task, int num_tasks) : next_task (0)
+        {
+            this->task = task;
+            this->num_tasks = num_tasks;
+            active_workers = 0;
+        }
+    };
+
+    WorkerPool ();
+
+    void start_workers ();
+    void stop_workers ();
+    void worker_thread ();
+    Job *find_job ();
+    static void run_tasks (Job *job);
+    static WorkerScratch &get_scratch ();
+
+    // guards workers and num_threads
+    std::mutex config_mutex;
+    std::vector<std::thread> workers;
+    int num_threads;
+    bool started;
+
+    // guards jobs, stop_flag and Job::active_workers
+    std::mutex mutex;
+    std::condition_variable jobs_cv;
+    std::condition_variable done_cv;
+    std::vector<Job *> jobs;
+    bool stop_flag;
+};
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <stdlib.h>
+
+#include "worker_pool.h"
+
+#define NUM_THREADS_ENV "BRAINFLOW_NUM_THREADS"
+
+
+static thread_local bool is_worker = false;
+
+
+WorkerPool &WorkerPool::get_instance ()
+{
+    // never destroyed, joining threads during unloading of library may hang on some platforms
+    static WorkerPool *pool = new WorkerPool ();
+    return *pool;
+}
+
+WorkerPool::WorkerPool ()
+{
+    started = false;
+    stop_flag = false;
+    num_threads = (int)std::thread::hardware_concurrency ();
+    const char *env_value = getenv (NUM_THREADS_ENV);
+    if (env_value != NULL)
+    {
+        num_threads = atoi (env_value);
+    }
+    if (num_threads < 1)
+    {
+        num_threads = 1;
+    }
+}
+
+bool WorkerPool::set_num_threads (int num_threads)
+{
+    if (num_threads < 1)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock (config_mutex);
+    if (num_threads == this->num_threads)
+    {
+        return true;
+    }
+    // running calls are not affected, they finish their tasks in calling threads if needed
+    stop_workers ();
+    this->num_threads = num_threads;
+    return true;
+}
+
+int WorkerPool::get_num_threads ()
+{
+    std::lock_guard<std::mutex> lock (config_mutex);
+    return num_threads;
+}
+
+void WorkerPool::start_workers ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        stop_flag = false;
+    }
+    for (int i = 0; i < num_threads - 1; i++)
+    {
+        workers.push_back (std::thread (&WorkerPool::worker_thread, this));
+    }
+    started = true;
+}
+
+void WorkerPool::stop_workers ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        stop_flag = true;
+    }
+    jobs_cv.notify_all ();
+    for (std::thread &worker : workers)
+    {
+        worker.join ();
+    }
+    workers.clear ();
+    started = false;
+}
+
+void WorkerPool::parallel_for (int num_tasks, const Task &task)
+{
+    if (num_tasks <= 0)
+    {
+        return;
+    }
+    bool has_workers = false;
+    if (!is_worker)
+    {
+        std::lock_guard<std::mutex> lock (config_mutex);
+        if (!started)
+        {
+            start_workers ();
+        }
+        has_workers = !workers.empty ();
+    }
+    if ((num_tasks == 1) || (!has_workers))
+    {
+        WorkerScratch &scratch = get_scratch ();
+        for (int i = 0; i < num_tasks; i++)
+        {
+            task (i, scratch);
+        }
+        return;
+    }
+
+    Job job (&task, num_tasks);
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        jobs.push_back (&job);
+    }
+    jobs_cv.notify_all ();
+    run_tasks (&job);
+    // all tasks are taken, wait for workers which are still executing them
+    std::unique_lock<std::mutex> lock (mutex);
+    jobs.erase (std::find (jobs.begin (), jobs.end (), &job));
+    done_cv.wait (lock, [&job] () { return job.active_workers == 0; });
+}
+
+void WorkerPool::worker_thread ()
+{
+    is_worker = true;
+    std::unique_lock<std::mutex> lock (mutex);
+    while (true)
+    {
+        Job *job = NULL;
+        jobs_cv.wait (lock, [this, &job] () {
+            job = find_job ();
+            return (stop_flag) || (job != NULL);
+        });
+        if (stop_flag)
+        {
+            return;
+        }
+        // job can not be destroyed while it has active workers
+        job->active_workers++;
+        lock.unlock ();
+        run_tasks (job);
+        lock.lock ();
+        job->active_workers--;
+        if (job->active_workers == 0)
+        {
+            done_cv.notify_all ();
+        }
+    }
+}
+
+WorkerPool::Job *WorkerPool::find_job ()
+{
+    for (Job *job : jobs)
+    {
+        if (job->next_task.load () < job->num_tasks)
+        {
+            return job;
+        }
+    }
+    return NULL;
+}
+
+void WorkerPool::run_tasks (Job *job)
+{
+    WorkerScratch &scratch = get_scratch ();
+    while (true)
+    {
+        int task_id = job->next_task.fetch_add (1);
+        if (task_id >= job->num_tasks)
+        {
+            return;
+        }
+        (*job->task) (task_id, scratch);
+    }
+}
+
+WorkerScratch &WorkerPool::get_scratch ()
+{
+    static thread_local WorkerScratch scratch;
+    return scratch;
+}
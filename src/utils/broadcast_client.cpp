@@ -61,6 +61,11 @@ int BroadCastClient::recv (void *data, int size)
     return res;
 }
 
+int BroadCastClient::recv_batch (DatagramBatch *batch)
+{
+    return batch->recv (connect_socket);
+}
+
 void BroadCastClient::close ()
 {
     closesocket (connect_socket);
@@ -68,6 +73,11 @@ void BroadCastClient::close ()
     WSACleanup ();
 }
 
+int BroadCastClient::get_file_descriptor ()
+{
+    return -1;
+}
+
 ///////////////////////////////
 //////////// UNIX /////////////
 ///////////////////////////////
@@ -119,9 +129,20 @@ int BroadCastClient::recv (void *data, int size)
     return res;
 }
 
+int BroadCastClient::recv_batch (DatagramBatch *batch)
+{
+    return batch->recv (connect_socket);
+}
+
 void BroadCastClient::close ()
 {
     ::close (connect_socket);
     connect_socket = -1;
 }
+
+int BroadCastClient::get_file_descriptor ()
+{
+    return connect_socket;
+}
+
 #endif
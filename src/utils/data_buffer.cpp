@@ -1,12 +1,46 @@
+#include <algorithm>
+#include <thread>
+
 #include "data_buffer.h"
 
-DataBuffer::DataBuffer (int num_samples, size_t buffer_size)
+// copies len samples of num_channels channels between buffers with different layouts, strides are
+// distances between neighbour samples and neighbour channels
+static void copy_samples (const double *src, size_t src_sample_stride, size_t src_channel_stride,
+    double *dst, size_t dst_sample_stride, size_t dst_channel_stride, size_t len,
+    size_t num_channels)
 {
+    // process samples in blocks to keep source and destination in cache for many channels
+    const size_t block_size = 64;
+    for (size_t block_start = 0; block_start < len; block_start += block_size)
+    {
+        size_t block_len = std::min (block_size, len - block_start);
+        for (size_t j = 0; j < num_channels; j++)
+        {
+            const double *src_channel =
+                src + block_start * src_sample_stride + j * src_channel_stride;
+            double *dst_channel = dst + block_start * dst_sample_stride + j * dst_channel_stride;
+            for (size_t i = 0; i < block_len; i++)
+            {
+                dst_channel[i * dst_sample_stride] = src_channel[i * src_sample_stride];
+            }
+        }
+    }
+}
+
+
+DataBuffer::DataBuffer (
+    int num_samples, size_t buffer_size, BufferLayouts layout, DataBufferObserver *observer)
+    : head (0), claim (0), tail (0)
+{
+    next_reader_id = 0;
     this->buffer_size = buffer_size;
     this->num_samples = num_samples;
+    this->layout = layout;
+    this->observer = observer;
+    // one slot is always reserved for sample which is being written by producer
+    capacity = buffer_size - 1;
     data = new double[buffer_size * num_samples];
     timestamps = new double[buffer_size];
-    first_free = first_used = count = 0;
 }
 
 DataBuffer::~DataBuffer ()
@@ -22,75 +56,314 @@ bool DataBuffer::is_ready ()
 
 void DataBuffer::add_data (double timestamp, double *value)
 {
-    lock.lock ();
-    this->timestamps[first_free] = timestamp;
-    memcpy (this->data + first_free * num_samples, value, sizeof (double) * num_samples);
-    first_free = next (first_free);
-    count++;
-    if (first_free == first_used)
+    add_data_batch (&timestamp, value, 1);
+}
+
+void DataBuffer::add_data_batch (const double *timestamps, const double *samples, size_t n)
+{
+    if (n == 0)
     {
-        first_used = next (first_used);
-        count--;
+        return;
+    }
+    // only producer modifies head and claim
+    uint64_t index = head.load (std::memory_order_relaxed);
+    // samples which dont fit to the buffer would be overwritten immediately, skip them
+    size_t skip = (n > capacity) ? n - capacity : 0;
+    uint64_t first_index = index + skip;
+    size_t num_to_write = n - skip;
+    // notify readers that slots are going to be overwritten before touching them
+    claim.store (index + n, std::memory_order_release);
+    std::atomic_thread_fence (std::memory_order_release);
+    size_t pos = (size_t)(first_index % buffer_size);
+    size_t first_half = std::min (num_to_write, buffer_size - pos);
+    write_samples (pos, timestamps + skip, samples + skip * num_samples, first_half);
+    write_samples (0, timestamps + skip + first_half,
+        samples + (skip + first_half) * num_samples, num_to_write - first_half);
+    head.store (index + n, std::memory_order_release);
+    if (observer != NULL)
+    {
+        observer->on_samples (timestamps, samples, n, num_samples);
     }
-    lock.unlock ();
 }
 
-void DataBuffer::get_chunk (size_t start, size_t size, double *ts_buf, double *data_buf)
+void DataBuffer::write_samples (
+    size_t pos, const double *timestamps, const double *samples, size_t n)
 {
-    if (start + size < buffer_size)
+    memcpy (this->timestamps + pos, timestamps, n * sizeof (double));
+    if (layout == BufferLayouts::INTERLEAVED)
     {
-        memcpy (ts_buf, timestamps + start, size * sizeof (double));
-        memcpy (data_buf, data + start * num_samples, size * sizeof (double) * num_samples);
+        memcpy (this->data + pos * num_samples, samples, n * sizeof (double) * num_samples);
     }
     else
     {
-        size_t first_half = buffer_size - start;
-        size_t second_half = size - first_half;
-        memcpy (ts_buf, timestamps + start, first_half * sizeof (double));
-        memcpy (data_buf, data + start * num_samples, first_half * sizeof (double) * num_samples);
-        memcpy (ts_buf + first_half, timestamps, second_half * sizeof (double));
-        memcpy (
-            data_buf + first_half * num_samples, data, second_half * sizeof (double) * num_samples);
+        copy_samples (samples, num_samples, 1, this->data + pos, 1, buffer_size, n, num_samples);
+    }
+}
+
+void DataBuffer::get_chunk (size_t start, size_t size, double *ts_buf, double *data_buf)
+{
+    // range is split into two contiguous spans if it crosses the end of ring
+    size_t first_half = std::min (size, buffer_size - start);
+    size_t spans_start[2] = {start, 0};
+    size_t spans_len[2] = {first_half, size - first_half};
+    size_t offset = 0;
+    for (int h = 0; h < 2; h++)
+    {
+        size_t pos = spans_start[h];
+        size_t len = spans_len[h];
+        memcpy (ts_buf + offset, timestamps + pos, len * sizeof (double));
+        if (layout == BufferLayouts::INTERLEAVED)
+        {
+            memcpy (data_buf + offset * num_samples, data + pos * num_samples,
+                len * sizeof (double) * num_samples);
+        }
+        else
+        {
+            copy_samples (data + pos, 1, buffer_size, data_buf + offset * num_samples,
+                num_samples, 1, len, num_samples);
+        }
+        offset += len;
     }
 }
 
+void DataBuffer::get_chunk (
+    size_t start, size_t size, double *output_buf, size_t output_offset, size_t output_len)
+{
+    size_t first_half = std::min (size, buffer_size - start);
+    size_t spans_start[2] = {start, 0};
+    size_t spans_len[2] = {first_half, size - first_half};
+    size_t offset = output_offset;
+    double *ts_row = output_buf + num_samples * output_len;
+    for (int h = 0; h < 2; h++)
+    {
+        size_t pos = spans_start[h];
+        size_t len = spans_len[h];
+        memcpy (ts_row + offset, timestamps + pos, len * sizeof (double));
+        if (layout == BufferLayouts::BY_CHANNELS)
+        {
+            for (size_t j = 0; j < num_samples; j++)
+            {
+                memcpy (output_buf + j * output_len + offset, data + j * buffer_size + pos,
+                    len * sizeof (double));
+            }
+        }
+        else
+        {
+            copy_samples (data + pos * num_samples, num_samples, 1, output_buf + offset, 1,
+                output_len, len, num_samples);
+        }
+        offset += len;
+    }
+}
+
+uint64_t DataBuffer::get_first_index (uint64_t head_index, uint64_t tail_index)
+{
+    uint64_t oldest = (head_index > capacity) ? head_index - capacity : 0;
+    return (tail_index > oldest) ? tail_index : oldest;
+}
+
+size_t DataBuffer::get_num_overwritten (uint64_t first_index)
+{
+    // slot of sample i is reused for sample i + buffer_size, producer could already start writing
+    // all samples up to claim - 1. After publishing oldest valid sample is claim - capacity like in
+    // get_first_index, samples before it may be corrupted or never written if batch was bigger
+    // than capacity and its leading samples were skipped
+    uint64_t claim_index = claim.load (std::memory_order_acquire);
+    if (claim_index > first_index + capacity)
+    {
+        return (size_t)(claim_index - capacity - first_index);
+    }
+    return 0;
+}
+
+uint64_t DataBuffer::copy_range (
+    uint64_t first_index, size_t size, double *ts_buf, double *data_buf)
+{
+    get_chunk ((size_t)(first_index % buffer_size), size, ts_buf, data_buf);
+    while (true)
+    {
+        std::atomic_thread_fence (std::memory_order_acquire);
+        size_t num_overwritten = get_num_overwritten (first_index);
+        if (num_overwritten == 0)
+        {
+            return first_index;
+        }
+        // drop corrupted samples and append the same number of newer samples instead, newer
+        // samples are already claimed by producer and will be published soon
+        first_index += num_overwritten;
+        wait_for_head (first_index + size);
+        if (num_overwritten >= size)
+        {
+            get_chunk ((size_t)(first_index % buffer_size), size, ts_buf, data_buf);
+        }
+        else
+        {
+            size_t num_valid = size - num_overwritten;
+            memmove (ts_buf, ts_buf + num_overwritten, num_valid * sizeof (double));
+            memmove (data_buf, data_buf + num_overwritten * num_samples,
+                num_valid * sizeof (double) * num_samples);
+            get_chunk ((size_t)((first_index + num_valid) % buffer_size), num_overwritten,
+                ts_buf + num_valid, data_buf + num_valid * num_samples);
+        }
+    }
+}
+
+uint64_t DataBuffer::copy_range (uint64_t first_index, size_t size, double *output_buf)
+{
+    get_chunk ((size_t)(first_index % buffer_size), size, output_buf, 0, size);
+    while (true)
+    {
+        std::atomic_thread_fence (std::memory_order_acquire);
+        size_t num_overwritten = get_num_overwritten (first_index);
+        if (num_overwritten == 0)
+        {
+            return first_index;
+        }
+        first_index += num_overwritten;
+        wait_for_head (first_index + size);
+        if (num_overwritten >= size)
+        {
+            get_chunk ((size_t)(first_index % buffer_size), size, output_buf, 0, size);
+        }
+        else
+        {
+            size_t num_valid = size - num_overwritten;
+            for (size_t j = 0; j < num_samples + 1; j++)
+            {
+                memmove (output_buf + j * size, output_buf + j * size + num_overwritten,
+                    num_valid * sizeof (double));
+            }
+            get_chunk ((size_t)((first_index + num_valid) % buffer_size), num_overwritten,
+                output_buf, num_valid, size);
+        }
+    }
+}
+
+void DataBuffer::wait_for_head (uint64_t index)
+{
+    while (head.load (std::memory_order_acquire) < index)
+    {
+        std::this_thread::yield ();
+    }
+}
+
+size_t DataBuffer::get_range (
+    size_t max_count, uint64_t head_index, uint64_t tail_index, uint64_t *first_index)
+{
+    *first_index = get_first_index (head_index, tail_index);
+    size_t result_count = max_count;
+    if (result_count > head_index - *first_index)
+        result_count = (size_t)(head_index - *first_index);
+    return result_count;
+}
+
 // removes data from buffer
 size_t DataBuffer::get_data (size_t max_count, double *ts_buf, double *data_buf)
 {
-    lock.lock ();
-    size_t result_count = max_count;
-    if (result_count > count)
-        result_count = count;
-    if (result_count)
+    while (true)
     {
-        get_chunk (first_used, result_count, ts_buf, data_buf);
-        first_used = (first_used + result_count) % buffer_size;
-        count -= result_count;
+        uint64_t tail_index = tail.load (std::memory_order_acquire);
+        uint64_t first_index = 0;
+        size_t result_count = get_range (
+            max_count, head.load (std::memory_order_acquire), tail_index, &first_index);
+        if (!result_count)
+        {
+            return 0;
+        }
+        first_index = copy_range (first_index, result_count, ts_buf, data_buf);
+        // if another reader removed data concurrently copied samples may be already returned
+        if (tail.compare_exchange_strong (tail_index, first_index + result_count))
+        {
+            return result_count;
+        }
+    }
+}
+
+size_t DataBuffer::get_data (size_t max_count, double *output_buf)
+{
+    while (true)
+    {
+        uint64_t tail_index = tail.load (std::memory_order_acquire);
+        uint64_t first_index = 0;
+        size_t result_count = get_range (
+            max_count, head.load (std::memory_order_acquire), tail_index, &first_index);
+        if (!result_count)
+        {
+            return 0;
+        }
+        first_index = copy_range (first_index, result_count, output_buf);
+        if (tail.compare_exchange_strong (tail_index, first_index + result_count))
+        {
+            return result_count;
+        }
     }
-    lock.unlock ();
-    return result_count;
 }
 
 // doesn't remove data from buffer
 size_t DataBuffer::get_current_data (size_t max_count, double *ts_buf, double *data_buf)
 {
-    lock.lock ();
-    size_t result_count = max_count;
-    if (result_count > count)
-        result_count = count;
+    uint64_t head_index = head.load (std::memory_order_acquire);
+    uint64_t first_index = 0;
+    size_t result_count = get_range (
+        max_count, head_index, tail.load (std::memory_order_acquire), &first_index);
     if (result_count)
     {
-        size_t first_return = (first_used + (count - result_count)) % buffer_size;
-        get_chunk (first_return, result_count, ts_buf, data_buf);
+        copy_range (head_index - result_count, result_count, ts_buf, data_buf);
+    }
+    return result_count;
+}
+
+size_t DataBuffer::get_current_data (size_t max_count, double *output_buf)
+{
+    uint64_t head_index = head.load (std::memory_order_acquire);
+    uint64_t first_index = 0;
+    size_t result_count = get_range (
+        max_count, head_index, tail.load (std::memory_order_acquire), &first_index);
+    if (result_count)
+    {
+        copy_range (head_index - result_count, result_count, output_buf);
     }
-    lock.unlock ();
     return result_count;
 }
 
 size_t DataBuffer::get_data_count ()
 {
-    lock.lock ();
-    size_t result = this->count;
-    lock.unlock ();
-    return result;
+    uint64_t head_index = head.load (std::memory_order_acquire);
+    uint64_t first_index = get_first_index (head_index, tail.load (std::memory_order_acquire));
+    return (size_t)(head_index - first_index);
+}
+
+int DataBuffer::create_reader ()
+{
+    std::lock_guard<std::mutex> lock (readers_mutex);
+    int reader_id = next_reader_id++;
+    // new reader gets only samples added after its creation
+    readers[reader_id] = head.load (std::memory_order_acquire);
+    return reader_id;
+}
+
+bool DataBuffer::release_reader (int reader_id)
+{
+    std::lock_guard<std::mutex> lock (readers_mutex);
+    return readers.erase (reader_id) > 0;
+}
+
+bool DataBuffer::get_new_data (
+    int reader_id, size_t max_count, double *output_buf, size_t *result_count)
+{
+    std::lock_guard<std::mutex> lock (readers_mutex);
+    auto reader = readers.find (reader_id);
+    if (reader == readers.end ())
+    {
+        return false;
+    }
+    uint64_t first_index = 0;
+    *result_count = get_range (
+        max_count, head.load (std::memory_order_acquire), reader->second, &first_index);
+    if (*result_count)
+    {
+        first_index = copy_range (first_index, *result_count, output_buf);
+        reader->second = first_index + *result_count;
+    }
+    return true;
 }
@@ -0,0 +1,115 @@
+#include <string.h>
+
+#include "datagram_batch.h"
+
+
+DatagramBatch::DatagramBatch (int max_datagrams, int max_datagram_size)
+{
+    this->max_datagrams = (max_datagrams < 1) ? 1 : max_datagrams;
+    this->max_datagram_size = (max_datagram_size < 1) ? 1 : max_datagram_size;
+    num_datagrams = 0;
+    slab = new unsigned char[(size_t)this->max_datagrams * this->max_datagram_size];
+    sizes.resize (this->max_datagrams, 0);
+#ifdef __linux__
+    // headers point to slab, they are reused by all calls
+    headers.resize (this->max_datagrams);
+    iovecs.resize (this->max_datagrams);
+    memset (headers.data (), 0, sizeof (struct mmsghdr) * headers.size ());
+    for (int i = 0; i < this->max_datagrams; i++)
+    {
+        iovecs[i].iov_base = slab + (size_t)i * this->max_datagram_size;
+        iovecs[i].iov_len = (size_t)this->max_datagram_size;
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+#endif
+}
+
+DatagramBatch::~DatagramBatch ()
+{
+    delete[] slab;
+}
+
+///////////////////////////////
+/////////// WINDOWS ///////////
+//////////////////////////////
+#ifdef _WIN32
+
+int DatagramBatch::recv (DatagramSocket socket)
+{
+    num_datagrams = 0;
+    while (num_datagrams < max_datagrams)
+    {
+        // dont block if the next datagram is not received yet
+        if (num_datagrams > 0)
+        {
+            u_long queued = 0;
+            if ((ioctlsocket (socket, FIONREAD, &queued) != 0) || (queued == 0))
+            {
+                break;
+            }
+        }
+        int res = recvfrom (socket, (char *)slab + (size_t)num_datagrams * max_datagram_size,
+            max_datagram_size, 0, NULL, NULL);
+        // too big datagram is truncated like in recvfrom on other platforms
+        if ((res == SOCKET_ERROR) && (WSAGetLastError () == WSAEMSGSIZE))
+        {
+            res = max_datagram_size;
+        }
+        if (res == SOCKET_ERROR)
+        {
+            break;
+        }
+        sizes[num_datagrams] = res;
+        num_datagrams++;
+    }
+    return (num_datagrams > 0) ? num_datagrams : -1;
+}
+
+///////////////////////////////
+//////////// LINUX ////////////
+///////////////////////////////
+#elif defined(__linux__)
+
+int DatagramBatch::recv (DatagramSocket socket)
+{
+    // MSG_WAITFORONE: blocks only for the first datagram
+    num_datagrams = 0;
+    int res = recvmmsg (socket, headers.data (), (unsigned int)max_datagrams, MSG_WAITFORONE, NULL);
+    if (res <= 0)
+    {
+        return -1;
+    }
+    for (int i = 0; i < res; i++)
+    {
+        sizes[i] = (int)headers[i].msg_len;
+    }
+    num_datagrams = res;
+    return num_datagrams;
+}
+
+///////////////////////////////
+//////////// OTHERS ///////////
+///////////////////////////////
+#else
+
+int DatagramBatch::recv (DatagramSocket socket)
+{
+    num_datagrams = 0;
+    while (num_datagrams < max_datagrams)
+    {
+        // dont block if the next datagram is not received yet
+        int flags = (num_datagrams > 0) ? MSG_DONTWAIT : 0;
+        int res = (int)recvfrom (socket, slab + (size_t)num_datagrams * max_datagram_size,
+            max_datagram_size, flags, NULL, NULL);
+        if (res < 0)
+        {
+            break;
+        }
+        sizes[num_datagrams] = res;
+        num_datagrams++;
+    }
+    return (num_datagrams > 0) ? num_datagrams : -1;
+}
+
+#endif
@@ -59,11 +59,20 @@ enum class FilterTypes : int
     BESSEL = 2
 };
 
+enum class FilterOperations : int
+{
+    LOWPASS = 0,
+    HIGHPASS = 1,
+    BANDPASS = 2,
+    BANDSTOP = 3
+};
+
 enum class AggOperations : int
 {
     MEAN = 0,
     MEDIAN = 1,
-    EACH = 2
+    EACH = 2,
+    FIR_DECIMATION = 3
 };
 
 enum class WindowFunctions : int
@@ -81,6 +90,12 @@ enum class DetrendOperations : int
     LINEAR = 2
 };
 
+enum class BufferLayouts : int
+{
+    INTERLEAVED = 0,
+    BY_CHANNELS = 1
+};
+
 enum class BrainFlowMetrics : int
 {
     RELAXATION = 0,
@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "datagram_batch.h"
+
 
 enum class BroadCastClientReturnCodes : int
 {
@@ -33,7 +35,11 @@ public:
 
     int init ();
     int recv (void *data, int size);
+    // receives already queued datagrams into batch, on linux with one syscall
+    int recv_batch (DatagramBatch *batch);
     void close ();
+    // descriptor for IOReactor, -1 on windows
+    int get_file_descriptor ();
 
     int get_port ()
     {
@@ -4,7 +4,7 @@
 #include <stdint.h>
 
 // copypasted from OpenBCI_JavaScript_Utilities
-inline int32_t cast_24bit_to_int32 (unsigned char *byte_array)
+inline int32_t cast_24bit_to_int32 (const unsigned char *byte_array)
 {
     int prefix = 0;
     if (byte_array[0] > 127)
@@ -14,7 +14,7 @@ inline int32_t cast_24bit_to_int32 (unsigned char *byte_array)
     return (prefix << 24) | (byte_array[0] << 16) | (byte_array[1] << 8) | byte_array[2];
 }
 
-inline int32_t cast_16bit_to_int32 (unsigned char *byte_array)
+inline int32_t cast_16bit_to_int32 (const unsigned char *byte_array)
 {
     int prefix = 0;
     if (byte_array[0] > 127)
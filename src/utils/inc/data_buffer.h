@@ -1,36 +1,96 @@
 #pragma once
 
-#include "spinlock.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-class DataBuffer
+#include "brainflow_constants.h"
+
+// gets all samples added to DataBuffer, called from producer thread after samples are published
+class DataBufferObserver
 {
+public:
+    virtual ~DataBufferObserver ()
+    {
+    }
+    virtual void on_samples (
+        const double *timestamps, const double *samples, size_t n, size_t num_channels) = 0;
+};
 
-    SpinLock lock;
+// single producer multi reader ring buffer, producer never waits for readers
+// head - number of samples published by producer, claim - number of samples producer started to
+// write, tail - first sample which was not removed by get_data. All indices are monotonic and
+// converted to positions in ring via modulo. Readers copy data without locks and validate copied
+// range after copying using claim(seqlock like approach)
+// Samples can be stored interleaved(one sample of all channels after another) or by channels(each
+// channel has its own contiguous ring), reading of channels from the second layout is just memcpy
+class DataBuffer
+{
 
     double *timestamps;
     double *data;
 
     size_t buffer_size;
-    size_t first_used, first_free;
-    size_t count;
+    size_t capacity;
     size_t num_samples;
+    BufferLayouts layout;
+    DataBufferObserver *observer;
 
-    size_t next (size_t index)
-    {
-        return (index + 1) % buffer_size;
-    }
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> claim;
+    std::atomic<uint64_t> tail;
+
+    // positions of non destructive readers, used only from consumer side
+    std::mutex readers_mutex;
+    std::map<int, uint64_t> readers;
+    int next_reader_id;
 
     void get_chunk (size_t start, size_t size, double *tsBuf, double *data_buf);
+    // writes samples directly to table with output_len columns, one row per channel and last row
+    // for timestamps, first sample goes to column output_offset
+    void get_chunk (size_t start, size_t size, double *output_buf, size_t output_offset,
+        size_t output_len);
+    // returns index of the oldest sample available for reading for provided head
+    uint64_t get_first_index (uint64_t head_index, uint64_t tail_index);
+    // returns number of leading samples in range which could be overwritten during copying
+    size_t get_num_overwritten (uint64_t first_index);
+    // copies exactly size samples starting from first_index, if some of them were overwritten
+    // during copying they are replaced by newer samples, returns index of the first copied sample
+    uint64_t copy_range (uint64_t first_index, size_t size, double *ts_buf, double *data_buf);
+    uint64_t copy_range (uint64_t first_index, size_t size, double *output_buf);
+    // waits until producer publishes all samples before index, used only when producer already
+    // claimed them
+    void wait_for_head (uint64_t index);
+    // writes samples to consecutive positions in ring without publishing them
+    void write_samples (size_t pos, const double *timestamps, const double *samples, size_t n);
+    // returns number of samples available for reading starting from first_index
+    size_t get_range (
+        size_t max_count, uint64_t head_index, uint64_t tail_index, uint64_t *first_index);
 
 public:
-    DataBuffer (int num_samples, size_t buffer_size);
+    // observer is not owned by buffer
+    DataBuffer (int num_samples, size_t buffer_size,
+        BufferLayouts layout = BufferLayouts::INTERLEAVED, DataBufferObserver *observer = NULL);
     ~DataBuffer ();
 
     void add_data (double timestamp, double *value);
+    // adds n samples stored one after another in samples array and publishes them at once
+    void add_data_batch (const double *timestamps, const double *samples, size_t n);
     size_t get_data (size_t max_count, double *ts_buf, double *data_buf);
     size_t get_current_data (size_t max_count, double *ts_buf, double *data_buf);
+    // the same as methods above but output_buf is a table with num_samples + 1 rows(last row for
+    // timestamps) and result_count columns, so no reshaping is needed
+    size_t get_data (size_t max_count, double *output_buf);
+    size_t get_current_data (size_t max_count, double *output_buf);
     size_t get_data_count ();
+    // readers get every sample exactly once(unless it was overwritten before reading) and dont
+    // remove data from buffer, so they dont affect get_data and each other
+    int create_reader ();
+    bool release_reader (int reader_id);
+    // output format is the same as for get_data with output_buf, returns false for unknown reader
+    bool get_new_data (int reader_id, size_t max_count, double *output_buf, size_t *result_count);
     bool is_ready ();
 };
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#endif
+
+#include <vector>
+
+#ifdef _WIN32
+typedef SOCKET DatagramSocket;
+#else
+typedef int DatagramSocket;
+#endif
+
+
+// preallocated storage for datagrams received by a single recv call. On linux all datagrams
+// which are already in socket buffer are read by one recvmmsg syscall, on other platforms they
+// are read in a loop. Datagrams are valid until the next recv
+class DatagramBatch
+{
+public:
+    DatagramBatch (int max_datagrams, int max_datagram_size);
+    ~DatagramBatch ();
+
+    // waits for the first datagram like recvfrom(up to socket timeout) and takes up to
+    // max_datagrams - 1 datagrams which are already received, returns number of datagrams or -1
+    // if there is no data. Datagrams bigger than max_datagram_size are truncated
+    int recv (DatagramSocket socket);
+
+    int get_num_datagrams ()
+    {
+        return num_datagrams;
+    }
+    const unsigned char *get_datagram (int index)
+    {
+        return slab + (size_t)index * max_datagram_size;
+    }
+    int get_datagram_size (int index)
+    {
+        return sizes[index];
+    }
+    int get_max_datagrams ()
+    {
+        return max_datagrams;
+    }
+
+private:
+    int max_datagrams;
+    int max_datagram_size;
+    int num_datagrams;
+    unsigned char *slab;
+    std::vector<int> sizes;
+#ifdef __linux__
+    std::vector<struct mmsghdr> headers;
+    std::vector<struct iovec> iovecs;
+#endif
+
+    DatagramBatch (const DatagramBatch &) = delete;
+    DatagramBatch &operator= (const DatagramBatch &) = delete;
+};
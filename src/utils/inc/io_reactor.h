@@ -0,0 +1,86 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+
+enum class IOReactorReturnCodes : int
+{
+    STATUS_OK = 0,
+    INIT_ERROR = 1,
+    INVALID_ARGUMENT_ERROR = 2,
+    ALREADY_REGISTERED_ERROR = 3,
+    NOT_REGISTERED_ERROR = 4
+};
+
+
+// optional replacement for per board read threads: one epoll thread waits for all registered
+// descriptors(sockets, serial ports) and runs their handlers in a small pool of worker threads.
+// Handler of a descriptor is never executed concurrently, while descriptor is registered it's
+// in non blocking mode and handler should read all available data. If descriptor hangs up(serial
+// port unplugged, peer reset) handler is called one more time with is_hung_up set to read the
+// rest of data and report the failure, after that it's not called again until remove. Threads are
+// started on the first add and stopped when the last descriptor is removed. Linux only, enabled by
+// env variable with number of worker threads
+class IOReactor
+{
+public:
+    typedef std::function<void (bool is_hung_up)> Handler;
+
+    // returns NULL if reactor is not enabled or not supported, boards use their own threads
+    static IOReactor *get_instance ();
+
+    int add (int fd, const Handler &handler);
+    // after return handler is not running and will not be called again, it doesnt wait for data.
+    // Original flags are restored when handler is finished, if handler removes its own descriptor
+    // it should not close it before return
+    int remove (int fd);
+
+private:
+    struct Registration
+    {
+        uint64_t id;
+        int fd;
+        int fd_flags; // restored in remove or after running handler
+        Handler handler;
+        bool is_busy; // queued or running
+        bool is_running;
+        bool is_removed;
+        bool is_hung_up; // not rearmed after handler
+    };
+
+    IOReactor (int num_workers);
+
+    int start ();
+    void stop ();
+    void poll_thread ();
+    void worker_thread ();
+    void rearm (Registration *registration);
+
+    int num_workers;
+    int epoll_fd;
+    int wakeup_fd; // eventfd to interrupt epoll_wait on stop
+    std::thread poller;
+    std::vector<std::thread> workers;
+    bool started;
+    // guards threads, add and remove are serialized with start and stop
+    std::mutex config_mutex;
+
+    // guards everything below
+    std::mutex mutex;
+    std::condition_variable ready_cv;
+    std::condition_variable done_cv;
+    // key is registration id, fds can be reused after close and events for removed
+    // registrations should be ignored
+    std::map<uint64_t, std::shared_ptr<Registration>> registrations;
+    std::deque<std::shared_ptr<Registration>> ready;
+    uint64_t next_id;
+    bool stop_flag;
+};
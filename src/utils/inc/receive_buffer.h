@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+
+
+// fixed capacity byte buffer for stream transports(tcp, serial), transport writes directly to
+// free space and parsers read packets in place. Unread bytes are always contiguous: before
+// writing they are moved to the beginning, usually it's only a tail of incomplete packet
+class ReceiveBuffer
+{
+public:
+    explicit ReceiveBuffer (size_t capacity);
+    ~ReceiveBuffer ();
+
+    // returns pointer to free space and its size, 0 if buffer is full
+    unsigned char *get_write_ptr (size_t *free_size);
+    // marks size bytes after write ptr as received
+    void commit (size_t size);
+
+    // unread bytes
+    const unsigned char *get_data ()
+    {
+        return data + start;
+    }
+    size_t get_size ()
+    {
+        return end - start;
+    }
+    size_t get_capacity ()
+    {
+        return capacity;
+    }
+    // copies up to size unread bytes to dest and removes them, returns number of copied bytes
+    size_t read (void *dest, size_t size);
+    // removes size unread bytes
+    void consume (size_t size);
+    // drops unread bytes before the first occurrence of value, returns false and drops all
+    // bytes if it's not found
+    bool skip_to (unsigned char value);
+    void clear ()
+    {
+        start = 0;
+        end = 0;
+    }
+
+private:
+    unsigned char *data;
+    size_t capacity;
+    size_t start;
+    size_t end;
+
+    ReceiveBuffer (const ReceiveBuffer &) = delete;
+    ReceiveBuffer &operator= (const ReceiveBuffer &) = delete;
+};
@@ -35,12 +35,16 @@ public:
     int set_custom_baudrate (int baudrate);
     int flush_buffer ();
     int read_from_serial_port (void *bytes_to_read, int size);
+    // waits for at least one byte(up to port timeout) and returns all received bytes up to max_size
+    int read_available (void *bytes_to_read, int max_size);
     int send_to_serial_port (const void *message, int length);
     int close_serial_port ();
     char *get_port_name ()
     {
         return port_name;
     }
+    // descriptor for IOReactor, -1 on windows
+    int get_file_descriptor ();
 
 private:
     char port_name[1024];
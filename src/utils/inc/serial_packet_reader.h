@@ -0,0 +1,33 @@
+#pragma once
+
+#include "receive_buffer.h"
+#include "serial.h"
+
+
+// reads serial port in large chunks instead of reading packages byte by byte and splits data
+// into packages which are parsed in place. Packages returned by peek methods are valid until the
+// next call, they should be removed by consume: with package size if package is valid or with 1
+// to search for the next start byte if package is corrupted
+class SerialPacketReader
+{
+public:
+    SerialPacketReader (Serial *serial, int buffer_size = 4096);
+
+    // package of package_size bytes which starts with start_byte, returns package_size or 0 if
+    // package is not received yet
+    int peek_packet (unsigned char start_byte, int package_size, const unsigned char **package);
+    // package of unknown size which starts with start_byte and ends with end_byte directly
+    // followed by start_byte of the next package, size includes start and end bytes and should be
+    // in [min_size, max_size). Returns package size or 0 if package is not received yet
+    int peek_delimited_packet (unsigned char start_byte, unsigned char end_byte, int min_size,
+        int max_size, const unsigned char **package);
+    void consume (int size);
+    int get_num_buffered ();
+
+private:
+    Serial *serial;
+    ReceiveBuffer receive_buffer;
+
+    // returns number of read bytes
+    int read_from_port ();
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+
+// reader writer lock for c++11, std::shared_mutex is available only since c++17
+// writers have priority: new readers wait if there is a writer waiting for the lock
+class SharedMutex
+{
+public:
+    SharedMutex ()
+    {
+        num_readers = 0;
+        num_waiting_writers = 0;
+        is_locked = false;
+    }
+
+    void lock ()
+    {
+        std::unique_lock<std::mutex> lk (m);
+        num_waiting_writers++;
+        cv.wait (lk, [this] { return ((!is_locked) && (num_readers == 0)); });
+        num_waiting_writers--;
+        is_locked = true;
+    }
+
+    void unlock ()
+    {
+        {
+            std::lock_guard<std::mutex> lk (m);
+            is_locked = false;
+        }
+        cv.notify_all ();
+    }
+
+    void lock_shared ()
+    {
+        std::unique_lock<std::mutex> lk (m);
+        cv.wait (lk, [this] { return ((!is_locked) && (num_waiting_writers == 0)); });
+        num_readers++;
+    }
+
+    void unlock_shared ()
+    {
+        bool notify = false;
+        {
+            std::lock_guard<std::mutex> lk (m);
+            num_readers--;
+            notify = (num_readers == 0);
+        }
+        if (notify)
+        {
+            cv.notify_all ();
+        }
+    }
+
+private:
+    std::mutex m;
+    std::condition_variable cv;
+    int num_readers;
+    int num_waiting_writers;
+    bool is_locked;
+
+    SharedMutex (const SharedMutex &) = delete;
+    SharedMutex &operator= (const SharedMutex &) = delete;
+};
+
+// the same as std::lock_guard but for shared ownership
+class SharedLockGuard
+{
+public:
+    explicit SharedLockGuard (SharedMutex &mutex) : mutex (mutex)
+    {
+        mutex.lock_shared ();
+    }
+
+    ~SharedLockGuard ()
+    {
+        mutex.unlock_shared ();
+    }
+
+private:
+    SharedMutex &mutex;
+
+    SharedLockGuard (const SharedLockGuard &) = delete;
+    SharedLockGuard &operator= (const SharedLockGuard &) = delete;
+};
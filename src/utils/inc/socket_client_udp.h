@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "datagram_batch.h"
+
 
 enum class SocketClientUDPReturnCodes : int
 {
@@ -40,7 +42,11 @@ public:
     int set_timeout (int num_seconds);
     int send (const char *data, int size);
     int recv (void *data, int size);
+    // receives already queued datagrams into batch, on linux with one syscall
+    int recv_batch (DatagramBatch *batch);
     void close ();
+    // descriptor for IOReactor, -1 on windows
+    int get_file_descriptor ();
     int get_local_ip_addr (char *local_ip);
     char *get_ip_addr ()
     {
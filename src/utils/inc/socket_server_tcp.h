@@ -8,11 +8,12 @@
 #include <unistd.h>
 #endif
 
-#include <queue>
 #include <stdlib.h>
 #include <string.h>
 #include <thread>
 
+#include "receive_buffer.h"
+
 enum class SocketServerTCPReturnCodes : int
 {
     STATUS_OK = 0,
@@ -27,6 +28,8 @@ class SocketServerTCP
 {
 
 public:
+    static constexpr int buffer_size = 65536;
+
     SocketServerTCP (const char *local_ip, int local_port, bool recv_all_or_nothing);
     ~SocketServerTCP ()
     {
@@ -35,8 +38,19 @@ public:
 
     int bind ();
     int accept ();
+    // if recv_all_or_nothing is true returns size or 0 if not enough data received yet
     int recv (void *data, int size);
+    // waits for packet of packet_size bytes which starts with start_byte, bytes before start byte
+    // are dropped. Returns packet_size and sets packet to bytes in internal buffer(valid until the
+    // next call), 0 if packet is not received yet or -1 on error. Packet is not removed, call
+    // consume with packet_size to remove it or with 1 to find the next start byte if it's corrupted
+    int peek_packet (unsigned char start_byte, int packet_size, const unsigned char **packet);
+    void consume (int size);
+    // number of received bytes which are not returned by recv or consumed yet
+    int get_num_buffered ();
     void close ();
+    // descriptor of connected client for IOReactor, -1 on windows or if not connected
+    int get_file_descriptor ();
     void accept_worker ();
 
     volatile bool client_connected; // idea - stop accept blocking call by calling close in
@@ -47,11 +61,15 @@ private:
     int local_port;
     struct sockaddr_in server_addr;
     volatile struct sockaddr_in client_addr;
-    std::queue<char> temp_buffer;
+    // data from socket is read in large chunks and packets are returned from this buffer
+    ReceiveBuffer receive_buffer;
     bool recv_all_or_nothing;
 
     std::thread accept_thread;
 
+    // reads available data from socket to receive_buffer, returns number of bytes or -1 on error
+    int recv_to_buffer ();
+
 #ifdef _WIN32
     volatile SOCKET server_socket;
     volatile SOCKET connected_socket;
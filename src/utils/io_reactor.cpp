@@ -0,0 +1,335 @@
+#include <stdlib.h>
+
+#include "io_reactor.h"
+
+#define NUM_THREADS_ENV "BRAINFLOW_IO_REACTOR_THREADS"
+
+
+///////////////////////////////
+//////////// LINUX ////////////
+///////////////////////////////
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define MAX_EVENTS 64
+#define WAKEUP_ID 0
+
+
+static thread_local bool is_reactor_thread = false;
+
+
+IOReactor *IOReactor::get_instance ()
+{
+    // never destroyed, joining threads during unloading of library may hang on some platforms
+    static IOReactor *reactor = NULL;
+    static std::once_flag init_flag;
+    std::call_once (init_flag, [] () {
+        const char *env_value = getenv (NUM_THREADS_ENV);
+        int num_workers = (env_value == NULL) ? 0 : atoi (env_value);
+        if (num_workers > 0)
+        {
+            reactor = new IOReactor (num_workers);
+        }
+    });
+    return reactor;
+}
+
+IOReactor::IOReactor (int num_workers)
+{
+    this->num_workers = num_workers;
+    epoll_fd = -1;
+    wakeup_fd = -1;
+    started = false;
+    next_id = WAKEUP_ID + 1;
+    stop_flag = false;
+}
+
+int IOReactor::add (int fd, const Handler &handler)
+{
+    if ((fd < 0) || (!handler))
+    {
+        return (int)IOReactorReturnCodes::INVALID_ARGUMENT_ERROR;
+    }
+    std::lock_guard<std::mutex> config_lock (config_mutex);
+    if (!started)
+    {
+        int res = start ();
+        if (res != (int)IOReactorReturnCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    std::lock_guard<std::mutex> lock (mutex);
+    for (auto &it : registrations)
+    {
+        if (it.second->fd == fd)
+        {
+            return (int)IOReactorReturnCodes::ALREADY_REGISTERED_ERROR;
+        }
+    }
+    std::shared_ptr<Registration> registration (new Registration ());
+    registration->id = next_id++;
+    registration->fd = fd;
+    registration->fd_flags = fcntl (fd, F_GETFL);
+    registration->handler = handler;
+    registration->is_busy = false;
+    registration->is_running = false;
+    registration->is_removed = false;
+    registration->is_hung_up = false;
+    if ((registration->fd_flags == -1) ||
+        (fcntl (fd, F_SETFL, registration->fd_flags | O_NONBLOCK) == -1))
+    {
+        return (int)IOReactorReturnCodes::INVALID_ARGUMENT_ERROR;
+    }
+    struct epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    event.data.u64 = registration->id;
+    if (epoll_ctl (epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+        fcntl (fd, F_SETFL, registration->fd_flags);
+        return (int)IOReactorReturnCodes::INVALID_ARGUMENT_ERROR;
+    }
+    registrations[registration->id] = registration;
+    return (int)IOReactorReturnCodes::STATUS_OK;
+}
+
+int IOReactor::remove (int fd)
+{
+    std::lock_guard<std::mutex> config_lock (config_mutex);
+    std::unique_lock<std::mutex> lock (mutex);
+    std::shared_ptr<Registration> registration;
+    for (auto &it : registrations)
+    {
+        if (it.second->fd == fd)
+        {
+            registration = it.second;
+            break;
+        }
+    }
+    if (!registration)
+    {
+        return (int)IOReactorReturnCodes::NOT_REGISTERED_ERROR;
+    }
+    // queued handler is skipped by worker, running one should finish
+    registration->is_removed = true;
+    registrations.erase (registration->id);
+    epoll_ctl (epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    // running handler should not block in read, worker restores flags after it
+    if (!registration->is_running)
+    {
+        fcntl (fd, F_SETFL, registration->fd_flags);
+    }
+    // handler can remove itself, dont wait for it and dont stop threads in this case
+    if (is_reactor_thread)
+    {
+        return (int)IOReactorReturnCodes::STATUS_OK;
+    }
+    done_cv.wait (lock, [&registration] () { return !registration->is_running; });
+    if (registrations.empty ())
+    {
+        lock.unlock ();
+        stop ();
+    }
+    return (int)IOReactorReturnCodes::STATUS_OK;
+}
+
+int IOReactor::start ()
+{
+    epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+    wakeup_fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = WAKEUP_ID;
+    if ((epoll_fd == -1) || (wakeup_fd == -1) ||
+        (epoll_ctl (epoll_fd, EPOLL_CTL_ADD, wakeup_fd, &event) != 0))
+    {
+        if (epoll_fd != -1)
+        {
+            close (epoll_fd);
+            epoll_fd = -1;
+        }
+        if (wakeup_fd != -1)
+        {
+            close (wakeup_fd);
+            wakeup_fd = -1;
+        }
+        return (int)IOReactorReturnCodes::INIT_ERROR;
+    }
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        stop_flag = false;
+    }
+    poller = std::thread (&IOReactor::poll_thread, this);
+    for (int i = 0; i < num_workers; i++)
+    {
+        workers.push_back (std::thread (&IOReactor::worker_thread, this));
+    }
+    started = true;
+    return (int)IOReactorReturnCodes::STATUS_OK;
+}
+
+void IOReactor::stop ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        stop_flag = true;
+        ready.clear ();
+    }
+    uint64_t value = 1;
+    ssize_t res = write (wakeup_fd, &value, sizeof (value));
+    (void)res;
+    ready_cv.notify_all ();
+    poller.join ();
+    for (std::thread &worker : workers)
+    {
+        worker.join ();
+    }
+    workers.clear ();
+    close (epoll_fd);
+    close (wakeup_fd);
+    epoll_fd = -1;
+    wakeup_fd = -1;
+    started = false;
+}
+
+void IOReactor::poll_thread ()
+{
+    is_reactor_thread = true;
+    struct epoll_event events[MAX_EVENTS];
+    while (true)
+    {
+        int num_events = epoll_wait (epoll_fd, events, MAX_EVENTS, -1);
+        if ((num_events < 0) && (errno != EINTR))
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock (mutex);
+        if (stop_flag)
+        {
+            return;
+        }
+        bool has_ready = false;
+        for (int i = 0; i < num_events; i++)
+        {
+            auto it = registrations.find (events[i].data.u64);
+            // event for removed registration or wakeup
+            if ((it == registrations.end ()) || (it->second->is_busy))
+            {
+                continue;
+            }
+            it->second->is_busy = true;
+            // tcp peer which closed connection makes socket readable forever, it's a hang up too
+            it->second->is_hung_up =
+                ((events[i].events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0);
+            ready.push_back (it->second);
+            has_ready = true;
+        }
+        if (has_ready)
+        {
+            ready_cv.notify_all ();
+        }
+    }
+}
+
+void IOReactor::worker_thread ()
+{
+    is_reactor_thread = true;
+    std::unique_lock<std::mutex> lock (mutex);
+    while (true)
+    {
+        ready_cv.wait (lock, [this] () { return (stop_flag) || (!ready.empty ()); });
+        if (stop_flag)
+        {
+            return;
+        }
+        std::shared_ptr<Registration> registration = ready.front ();
+        ready.pop_front ();
+        if (!registration->is_removed)
+        {
+            registration->is_running = true;
+            lock.unlock ();
+            registration->handler (registration->is_hung_up);
+            lock.lock ();
+            registration->is_running = false;
+            // descriptor is not closed while registration is not removed or while remove waits
+            // for handler, remove needs mutex
+            if (registration->is_removed)
+            {
+                fcntl (registration->fd, F_SETFL, registration->fd_flags);
+            }
+            else if (!registration->is_hung_up)
+            {
+                rearm (registration.get ());
+            }
+        }
+        registration->is_busy = false;
+        done_cv.notify_all ();
+    }
+}
+
+void IOReactor::rearm (Registration *registration)
+{
+    // level triggered, so data which is received during handler call triggers it again
+    struct epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    event.data.u64 = registration->id;
+    epoll_ctl (epoll_fd, EPOLL_CTL_MOD, registration->fd, &event);
+}
+
+///////////////////////////////
+/////////// OTHERS ////////////
+///////////////////////////////
+#else
+
+IOReactor *IOReactor::get_instance ()
+{
+    return NULL;
+}
+
+IOReactor::IOReactor (int num_workers)
+{
+    this->num_workers = num_workers;
+    epoll_fd = -1;
+    wakeup_fd = -1;
+    started = false;
+    next_id = 0;
+    stop_flag = false;
+}
+
+int IOReactor::add (int fd, const Handler &handler)
+{
+    return (int)IOReactorReturnCodes::INIT_ERROR;
+}
+
+int IOReactor::remove (int fd)
+{
+    return (int)IOReactorReturnCodes::NOT_REGISTERED_ERROR;
+}
+
+int IOReactor::start ()
+{
+    return (int)IOReactorReturnCodes::INIT_ERROR;
+}
+
+void IOReactor::stop ()
+{
+}
+
+void IOReactor::poll_thread ()
+{
+}
+
+void IOReactor::worker_thread ()
+{
+}
+
+void IOReactor::rearm (Registration *registration)
+{
+}
+
+#endif
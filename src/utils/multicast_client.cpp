@@ -91,6 +91,11 @@ int MultiCastClient::recv (void *data, int size)
     return res;
 }
 
+int MultiCastClient::recv_batch (DatagramBatch *batch)
+{
+    return batch->recv (client_socket);
+}
+
 void MultiCastClient::close ()
 {
     closesocket (client_socket);
@@ -98,6 +103,11 @@ void MultiCastClient::close ()
     WSACleanup ();
 }
 
+int MultiCastClient::get_file_descriptor ()
+{
+    return -1;
+}
+
 ///////////////////////////////
 //////////// UNIX /////////////
 ///////////////////////////////
@@ -178,10 +188,20 @@ int MultiCastClient::recv (void *data, int size)
     return res;
 }
 
+int MultiCastClient::recv_batch (DatagramBatch *batch)
+{
+    return batch->recv (client_socket);
+}
+
 void MultiCastClient::close ()
 {
     ::close (client_socket);
     client_socket = -1;
 }
 
+int MultiCastClient::get_file_descriptor ()
+{
+    return client_socket;
+}
+
 #endif
@@ -0,0 +1,72 @@
+#include <string.h>
+
+#include "receive_buffer.h"
+
+
+ReceiveBuffer::ReceiveBuffer (size_t capacity)
+{
+    this->capacity = capacity;
+    data = new unsigned char[capacity];
+    start = 0;
+    end = 0;
+}
+
+ReceiveBuffer::~ReceiveBuffer ()
+{
+    delete[] data;
+}
+
+unsigned char *ReceiveBuffer::get_write_ptr (size_t *free_size)
+{
+    if (start == end)
+    {
+        start = 0;
+        end = 0;
+    }
+    else if (start > 0)
+    {
+        memmove (data, data + start, end - start);
+        end -= start;
+        start = 0;
+    }
+    *free_size = capacity - end;
+    return data + end;
+}
+
+void ReceiveBuffer::commit (size_t size)
+{
+    end += size;
+}
+
+size_t ReceiveBuffer::read (void *dest, size_t size)
+{
+    if (size > end - start)
+    {
+        size = end - start;
+    }
+    memcpy (dest, data + start, size);
+    start += size;
+    return size;
+}
+
+void ReceiveBuffer::consume (size_t size)
+{
+    if (size > end - start)
+    {
+        size = end - start;
+    }
+    start += size;
+}
+
+bool ReceiveBuffer::skip_to (unsigned char value)
+{
+    const unsigned char *found =
+        (const unsigned char *)memchr (data + start, value, end - start);
+    if (found == NULL)
+    {
+        start = end;
+        return false;
+    }
+    start = (size_t)(found - data);
+    return true;
+}
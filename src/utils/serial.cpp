@@ -92,6 +92,21 @@ int Serial::read_from_serial_port (void *bytes_to_read, int size)
     return (int)readed;
 }
 
+// with port timeouts ReadFile waits until all requested bytes are received, so request only
+// bytes which are already in driver queue
+int Serial::read_available (void *bytes_to_read, int max_size)
+{
+    COMSTAT stat;
+    DWORD errors;
+    int available = 0;
+    if (ClearCommError (this->port_descriptor, &errors, &stat))
+    {
+        available = (int)stat.cbInQue;
+    }
+    int size = (available > 0) ? ((available < max_size) ? available : max_size) : 1;
+    return read_from_serial_port (bytes_to_read, size);
+}
+
 int Serial::send_to_serial_port (const void *message, int length)
 {
     DWORD bytes_written;
@@ -110,6 +125,11 @@ int Serial::close_serial_port ()
     return SerialExitCodes::OK;
 }
 
+int Serial::get_file_descriptor ()
+{
+    return -1;
+}
+
 /////////////////////////////////////////////////
 //////////////////// Linux //////////////////////
 /////////////////////////////////////////////////
@@ -177,6 +197,12 @@ int Serial::read_from_serial_port (void *bytes_to_read, int size)
     return res;
 }
 
+// VMIN is 0, so read returns as soon as some bytes are received
+int Serial::read_available (void *bytes_to_read, int max_size)
+{
+    return read_from_serial_port (bytes_to_read, max_size);
+}
+
 int Serial::flush_buffer ()
 {
     tcflush (this->port_descriptor, TCIOFLUSH);
@@ -203,4 +229,9 @@ int Serial::close_serial_port ()
     return SerialExitCodes::OK;
 }
 
+int Serial::get_file_descriptor ()
+{
+    return this->is_port_open () ? port_descriptor : -1;
+}
+
 #endif
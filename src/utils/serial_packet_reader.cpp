@@ -0,0 +1,101 @@
+#include <string.h>
+
+#include "serial_packet_reader.h"
+
+
+SerialPacketReader::SerialPacketReader (Serial *serial, int buffer_size)
+    : receive_buffer ((size_t)buffer_size)
+{
+    this->serial = serial;
+}
+
+int SerialPacketReader::read_from_port ()
+{
+    size_t free_size = 0;
+    unsigned char *ptr = receive_buffer.get_write_ptr (&free_size);
+    if (free_size == 0)
+    {
+        return 0;
+    }
+    int res = serial->read_available (ptr, (int)free_size);
+    if (res > 0)
+    {
+        receive_buffer.commit ((size_t)res);
+    }
+    return res;
+}
+
+int SerialPacketReader::peek_packet (
+    unsigned char start_byte, int package_size, const unsigned char **package)
+{
+    if ((package == NULL) || (package_size <= 0) ||
+        ((size_t)package_size > receive_buffer.get_capacity ()))
+    {
+        return 0;
+    }
+    // port is read only if there is no complete package in buffer
+    receive_buffer.skip_to (start_byte);
+    if (receive_buffer.get_size () < (size_t)package_size)
+    {
+        read_from_port ();
+        receive_buffer.skip_to (start_byte);
+        if (receive_buffer.get_size () < (size_t)package_size)
+        {
+            return 0;
+        }
+    }
+    *package = receive_buffer.get_data ();
+    return package_size;
+}
+
+int SerialPacketReader::peek_delimited_packet (unsigned char start_byte, unsigned char end_byte,
+    int min_size, int max_size, const unsigned char **package)
+{
+    if ((package == NULL) || (min_size < 2) || (max_size <= min_size) ||
+        ((size_t)max_size >= receive_buffer.get_capacity ()))
+    {
+        return 0;
+    }
+    bool port_read = false;
+    while (true)
+    {
+        receive_buffer.skip_to (start_byte);
+        const unsigned char *data = receive_buffer.get_data ();
+        int size = (int)receive_buffer.get_size ();
+        // search for end byte followed by start byte of the next package
+        int limit = (size < max_size) ? size - 1 : max_size - 1;
+        for (int i = min_size - 1; i < limit; i++)
+        {
+            if ((data[i] == end_byte) && (data[i + 1] == start_byte))
+            {
+                *package = data;
+                return i + 1;
+            }
+        }
+        if (size >= max_size)
+        {
+            // there is no end of package in max_size bytes, start byte was wrong
+            receive_buffer.consume (1);
+            continue;
+        }
+        if (port_read)
+        {
+            return 0;
+        }
+        read_from_port ();
+        port_read = true;
+    }
+}
+
+void SerialPacketReader::consume (int size)
+{
+    if (size > 0)
+    {
+        receive_buffer.consume ((size_t)size);
+    }
+}
+
+int SerialPacketReader::get_num_buffered ()
+{
+    return (int)receive_buffer.get_size ();
+}
@@ -197,6 +197,11 @@ int SocketClientUDP::recv (void *data, int size)
     return res;
 }
 
+int SocketClientUDP::recv_batch (DatagramBatch *batch)
+{
+    return batch->recv (connect_socket);
+}
+
 void SocketClientUDP::close ()
 {
     closesocket (connect_socket);
@@ -204,6 +209,11 @@ void SocketClientUDP::close ()
     WSACleanup ();
 }
 
+int SocketClientUDP::get_file_descriptor ()
+{
+    return -1;
+}
+
 ///////////////////////////////
 //////////// UNIX /////////////
 ///////////////////////////////
@@ -381,9 +391,20 @@ int SocketClientUDP::recv (void *data, int size)
     return res;
 }
 
+int SocketClientUDP::recv_batch (DatagramBatch *batch)
+{
+    return batch->recv (connect_socket);
+}
+
 void SocketClientUDP::close ()
 {
     ::close (connect_socket);
     connect_socket = -1;
 }
+
+int SocketClientUDP::get_file_descriptor ()
+{
+    return connect_socket;
+}
+
 #endif
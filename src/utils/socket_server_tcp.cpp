@@ -11,6 +11,7 @@
 #pragma comment(lib, "AdvApi32.lib")
 
 SocketServerTCP::SocketServerTCP (const char *local_ip, int local_port, bool recv_all_or_nothing)
+    : receive_buffer (buffer_size)
 {
     strcpy (this->local_ip, local_ip);
     this->local_port = local_port;
@@ -96,45 +97,25 @@ void SocketServerTCP::accept_worker ()
     }
 }
 
-int SocketServerTCP::recv (void *data, int size)
+int SocketServerTCP::recv_to_buffer ()
 {
     if (connected_socket == INVALID_SOCKET)
     {
         return -1;
     }
-    int res = ::recv (connected_socket, (char *)data, size, 0);
-    if (res == SOCKET_ERROR)
-    {
-        return -1;
-    }
-    for (int i = 0; i < res; i++)
+    size_t free_size = 0;
+    unsigned char *ptr = receive_buffer.get_write_ptr (&free_size);
+    if (free_size == 0)
     {
-        temp_buffer.push (((char *)data)[i]);
+        return 0;
     }
-    // before we used SO_RCVLOWAT but it didnt work well
-    // and we were not sure that it works correctly with timeout
-    if (recv_all_or_nothing)
-    {
-        if (temp_buffer.size () < size)
-        {
-            return 0;
-        }
-        for (int i = 0; i < size; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
-        return size;
-    }
-    else
+    int res = ::recv (connected_socket, (char *)ptr, (int)free_size, 0);
+    if (res == SOCKET_ERROR)
     {
-        for (int i = 0; i < res; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
-        return res;
+        return -1;
     }
+    receive_buffer.commit ((size_t)res);
+    return res;
 }
 
 void SocketServerTCP::close ()
@@ -156,6 +137,11 @@ void SocketServerTCP::close ()
     WSACleanup ();
 }
 
+int SocketServerTCP::get_file_descriptor ()
+{
+    return -1;
+}
+
 ///////////////////////////////
 //////////// UNIX /////////////
 ///////////////////////////////
@@ -166,6 +152,7 @@ void SocketServerTCP::close ()
 
 
 SocketServerTCP::SocketServerTCP (const char *local_ip, int local_port, bool recv_all_or_nothing)
+    : receive_buffer (buffer_size)
 {
     strcpy (this->local_ip, local_ip);
     this->local_port = local_port;
@@ -245,45 +232,25 @@ void SocketServerTCP::accept_worker ()
     }
 }
 
-int SocketServerTCP::recv (void *data, int size)
+int SocketServerTCP::recv_to_buffer ()
 {
     if (connected_socket <= 0)
     {
         return -1;
     }
-    int res = ::recv (connected_socket, (char *)data, size, 0);
-    if (res < 0)
-    {
-        return res;
-    }
-    for (int i = 0; i < res; i++)
-    {
-        temp_buffer.push (((char *)data)[i]);
-    }
-    // before we used SO_RCVLOWAT but it didnt work well
-    // and we were not sure that it works correctly with timeout
-    if (recv_all_or_nothing)
+    size_t free_size = 0;
+    unsigned char *ptr = receive_buffer.get_write_ptr (&free_size);
+    if (free_size == 0)
     {
-        if (temp_buffer.size () < size)
-        {
-            return 0;
-        }
-        for (int i = 0; i < size; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
-        return size;
+        return 0;
     }
-    else
+    int res = (int)::recv (connected_socket, ptr, free_size, 0);
+    if (res < 0)
     {
-        for (int i = 0; i < res; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
         return res;
     }
+    receive_buffer.commit ((size_t)res);
+    return res;
 }
 
 void SocketServerTCP::close ()
@@ -303,4 +270,77 @@ void SocketServerTCP::close ()
         connected_socket = -1;
     }
 }
+
+int SocketServerTCP::get_file_descriptor ()
+{
+    return connected_socket;
+}
 #endif
+
+///////////////////////////////
+/////////// COMMON ////////////
+///////////////////////////////
+
+int SocketServerTCP::recv (void *data, int size)
+{
+    if ((data == NULL) || (size <= 0) || (size > buffer_size))
+    {
+        return -1;
+    }
+    // before we used SO_RCVLOWAT but it didnt work well
+    // and we were not sure that it works correctly with timeout
+    size_t num_buffered = receive_buffer.get_size ();
+    bool need_recv = recv_all_or_nothing ? (num_buffered < (size_t)size) : (num_buffered == 0);
+    if (need_recv)
+    {
+        int res = recv_to_buffer ();
+        if (res < 0)
+        {
+            return res;
+        }
+    }
+    if ((recv_all_or_nothing) && (receive_buffer.get_size () < (size_t)size))
+    {
+        return 0;
+    }
+    return (int)receive_buffer.read (data, (size_t)size);
+}
+
+int SocketServerTCP::peek_packet (
+    unsigned char start_byte, int packet_size, const unsigned char **packet)
+{
+    if ((packet == NULL) || (packet_size <= 0) || (packet_size > buffer_size))
+    {
+        return -1;
+    }
+    // socket is read only if there is no complete packet in buffer
+    receive_buffer.skip_to (start_byte);
+    if (receive_buffer.get_size () < (size_t)packet_size)
+    {
+        int res = recv_to_buffer ();
+        if (res < 0)
+        {
+            return res;
+        }
+        receive_buffer.skip_to (start_byte);
+        if (receive_buffer.get_size () < (size_t)packet_size)
+        {
+            return 0;
+        }
+    }
+    *packet = receive_buffer.get_data ();
+    return packet_size;
+}
+
+void SocketServerTCP::consume (int size)
+{
+    if (size > 0)
+    {
+        receive_buffer.consume ((size_t)size);
+    }
+}
+
+int SocketServerTCP::get_num_buffered ()
+{
+    return (int)receive_buffer.get_size ();
+}
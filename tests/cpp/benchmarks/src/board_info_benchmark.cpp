@@ -0,0 +1,58 @@
+#include <chrono>
+#include <iostream>
+
+#include "board_info_getter.h"
+#include "brainflow_constants.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// measures lookups per second for board description methods which bindings call on every read
+#define NUM_ITERATIONS 200000
+
+
+double measure_single_value (int (*method) (int, int *), int board_id);
+double measure_array_value (int (*method) (int, int *, int *), int board_id);
+
+
+int main (int argc, char *argv[])
+{
+    int board_ids[3] = {(int)BoardIds::SYNTHETIC_BOARD, (int)BoardIds::CYTON_BOARD,
+        (int)BoardIds::GALEA_BOARD};
+    cout << "board_id,num_rows_per_sec,timestamp_channel_per_sec,eeg_channels_per_sec,"
+            "exg_channels_per_sec"
+         << endl;
+    for (int i = 0; i < 3; i++)
+    {
+        cout << board_ids[i] << "," << measure_single_value (get_num_rows, board_ids[i]) << ","
+             << measure_single_value (get_timestamp_channel, board_ids[i]) << ","
+             << measure_array_value (get_eeg_channels, board_ids[i]) << ","
+             << measure_array_value (get_exg_channels, board_ids[i]) << endl;
+    }
+    return 0;
+}
+
+double measure_single_value (int (*method) (int, int *), int board_id)
+{
+    int value = 0;
+    auto start = high_resolution_clock::now ();
+    for (int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        method (board_id, &value);
+    }
+    auto stop = high_resolution_clock::now ();
+    return NUM_ITERATIONS / duration_cast<duration<double>> (stop - start).count ();
+}
+
+double measure_array_value (int (*method) (int, int *, int *), int board_id)
+{
+    int values[512];
+    int len = 0;
+    auto start = high_resolution_clock::now ();
+    for (int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        method (board_id, values, &len);
+    }
+    auto stop = high_resolution_clock::now ();
+    return NUM_ITERATIONS / duration_cast<duration<double>> (stop - start).count ();
+}
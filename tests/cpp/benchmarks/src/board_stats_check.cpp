@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <iostream>
+#include <math.h>
+#include <string>
+#include <vector>
+
+#include "board_stats.h"
+#include "data_buffer.h"
+#include "json.hpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+// feeds package nums like synthetic board(0..255, one sample per package num) and ganglion(1..100,
+// two samples per package num with the same timestamp) through DataBuffer into BoardStats and
+// checks reported counters, returns non zero exit code if something doesnt match
+#define NUM_CHANNELS 4
+#define NUM_PACKAGES 1000
+
+
+struct Expected
+{
+    uint64_t num_gaps;
+    uint64_t num_lost_samples;
+    uint64_t num_duplicates;
+    uint64_t num_out_of_order;
+    double mean_interval;
+};
+
+vector<double> synthetic_nums (vector<int> skip);
+vector<double> ganglion_nums (vector<int> skip, vector<int> repeat);
+bool check (const char *name, const vector<double> &nums, int samples_per_package_num,
+    double interval, Expected expected);
+
+
+int main (int argc, char *argv[])
+{
+    bool ok = true;
+    ok &= check ("synthetic healthy", synthetic_nums ({}), 1, 0.004, {0, 0, 0, 0, 0.004});
+    ok &= check ("synthetic lost", synthetic_nums ({10, 11, 300}), 1, 0.004, {2, 3, 0, 0, 0.004});
+    ok &= check ("ganglion healthy", ganglion_nums ({}, {}), 2, 0.01, {0, 0, 0, 0, 0.01});
+    ok &= check ("ganglion lost and duplicated", ganglion_nums ({50}, {70}), 2, 0.01,
+        {1, 1, 1, 0, 0.01});
+    return ok ? 0 : 1;
+}
+
+vector<double> synthetic_nums (vector<int> skip)
+{
+    vector<double> nums;
+    for (int i = 0; i < NUM_PACKAGES; i++)
+    {
+        if (find (skip.begin (), skip.end (), i) == skip.end ())
+        {
+            nums.push_back (i % 256);
+        }
+    }
+    return nums;
+}
+
+vector<double> ganglion_nums (vector<int> skip, vector<int> repeat)
+{
+    vector<double> nums;
+    for (int i = 0; i < NUM_PACKAGES; i++)
+    {
+        if (find (skip.begin (), skip.end (), i) != skip.end ())
+        {
+            continue;
+        }
+        int copies = (find (repeat.begin (), repeat.end (), i) == repeat.end ()) ? 2 : 3;
+        for (int j = 0; j < copies; j++)
+        {
+            nums.push_back (i % 100 + 1);
+        }
+    }
+    return nums;
+}
+
+bool check (const char *name, const vector<double> &nums, int samples_per_package_num,
+    double interval, Expected expected)
+{
+    BoardStats stats;
+    stats.restart (0, samples_per_package_num);
+    DataBuffer db (NUM_CHANNELS, nums.size (), BufferLayouts::INTERLEAVED, &stats);
+    double package[NUM_CHANNELS] = {0.0};
+    double timestamp = 0.0;
+    for (size_t i = 0; i < nums.size (); i++)
+    {
+        // samples from the same package have the same timestamp
+        if ((i > 0) && (nums[i] != nums[i - 1]))
+        {
+            timestamp += interval;
+        }
+        package[0] = nums[i];
+        db.add_data (timestamp, package);
+    }
+    json result = json::parse (stats.to_json ());
+    bool ok = (result["num_gaps"] == expected.num_gaps) &&
+        (result["num_lost_samples"] == expected.num_lost_samples) &&
+        (result["num_duplicates"] == expected.num_duplicates) &&
+        (result["num_out_of_order"] == expected.num_out_of_order) &&
+        (result["num_samples"] == nums.size ()) &&
+        (fabs ((double)result["mean_interval"] - expected.mean_interval) < 1e-6);
+    cout << (ok ? "OK " : "FAILED ") << name << " " << result.dump () << endl;
+    return ok;
+}
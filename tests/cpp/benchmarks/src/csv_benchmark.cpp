@@ -0,0 +1,120 @@
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "csv_reader.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// compares reading of csv file written by write_file via getc + stringstream + stod(how read_file
+// and get_num_elements_in_file did it before, file was read three times) with CSVReader
+#define NUM_ROWS 25 // rows in data table, cols in csv file
+#define NUM_SAMPLES 200000
+#define FILE_NAME "csv_benchmark.csv"
+
+
+void write_test_file ();
+int count_lines ();
+double read_with_streams (vector<double> &data);
+double read_with_csv_reader (vector<double> &data);
+
+
+int main (int argc, char *argv[])
+{
+    write_test_file ();
+    vector<double> old_data (NUM_ROWS * NUM_SAMPLES);
+    vector<double> new_data (NUM_ROWS * NUM_SAMPLES);
+    double streams_ms = read_with_streams (old_data);
+    double csv_reader_ms = read_with_csv_reader (new_data);
+    cout << "samples,streams_ms,csv_reader_ms,equal" << endl;
+    cout << NUM_SAMPLES << "," << streams_ms << "," << csv_reader_ms << ","
+         << (old_data == new_data) << endl;
+    remove (FILE_NAME);
+    return 0;
+}
+
+void write_test_file ()
+{
+    FILE *fp = fopen (FILE_NAME, "w");
+    for (int i = 0; i < NUM_SAMPLES; i++)
+    {
+        for (int j = 0; j < NUM_ROWS - 1; j++)
+        {
+            fprintf (fp, "%lf,", (i % 1000) * 0.123 - j * 1000.5);
+        }
+        fprintf (fp, "%lf\n", 1.6e9 + i * 0.004);
+    }
+    fclose (fp);
+}
+
+int count_lines ()
+{
+    FILE *fp = fopen (FILE_NAME, "r");
+    int total_rows = 0;
+    for (int c = getc (fp); c != EOF; c = getc (fp))
+    {
+        if (c == '\n')
+        {
+            total_rows++;
+        }
+    }
+    fclose (fp);
+    return total_rows;
+}
+
+double read_with_streams (vector<double> &data)
+{
+    auto start = high_resolution_clock::now ();
+    count_lines (); // get_num_elements_in_file
+    int total_rows = count_lines ();
+    FILE *fp = fopen (FILE_NAME, "r");
+    char buf[4096];
+    int current_row = 0;
+    while (fgets (buf, sizeof (buf), fp) != NULL)
+    {
+        std::stringstream ss ((std::string (buf)));
+        std::vector<std::string> splitted;
+        std::string tmp;
+        while (getline (ss, tmp, ','))
+        {
+            splitted.push_back (tmp);
+        }
+        for (size_t i = 0; i < splitted.size (); i++)
+        {
+            data[i * total_rows + current_row] = std::stod (splitted[i]);
+        }
+        current_row++;
+    }
+    fclose (fp);
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<microseconds> (stop - start).count () / 1000.0;
+}
+
+double read_with_csv_reader (vector<double> &data)
+{
+    auto start = high_resolution_clock::now ();
+    const char *line = NULL;
+    size_t line_len = 0;
+    // get_num_elements_in_file only splits lines
+    CSVReader counter;
+    counter.open (FILE_NAME);
+    int total_rows = 0;
+    while (counter.next_line (&line, &line_len))
+    {
+        total_rows++;
+    }
+    CSVReader reader;
+    reader.open (FILE_NAME);
+    int current_row = 0;
+    while (reader.next_line (&line, &line_len))
+    {
+        CSVReader::parse_line (line, line_len, data.data () + current_row, total_rows, NUM_ROWS);
+        current_row++;
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<microseconds> (stop - start).count () / 1000.0;
+}
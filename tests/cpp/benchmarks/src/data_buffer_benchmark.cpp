@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "data_buffer.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// measures latency of DataBuffer::add_data from acquisition thread while several readers
+// continuously copy the latest window from the same buffer like dashboards do
+#define NUM_CHANNELS 32
+#define BUFFER_SIZE 450000
+#define WINDOW_SIZE 2500 // 10 seconds with 250 Hz
+#define NUM_SAMPLES 2000000
+
+
+void run_benchmark (int num_readers);
+void reader_thread (DataBuffer *db, volatile bool *keep_alive, long long *num_reads);
+
+
+int main (int argc, char *argv[])
+{
+    cout << "readers,p50_ns,p99_ns,p999_ns,max_ns,reads" << endl;
+    for (int num_readers = 0; num_readers <= 4; num_readers++)
+    {
+        run_benchmark (num_readers);
+    }
+    return 0;
+}
+
+void run_benchmark (int num_readers)
+{
+    DataBuffer db (NUM_CHANNELS, BUFFER_SIZE);
+    double package[NUM_CHANNELS] = {0.0};
+    vector<long long> latencies (NUM_SAMPLES);
+    vector<long long> num_reads (num_readers, 0);
+    vector<thread> readers;
+    volatile bool keep_alive = true;
+
+    // prefill buffer to make sure that readers always copy full window
+    for (int i = 0; i < WINDOW_SIZE; i++)
+    {
+        package[0] = (double)i;
+        db.add_data ((double)i, package);
+    }
+    for (int i = 0; i < num_readers; i++)
+    {
+        readers.push_back (thread (reader_thread, &db, &keep_alive, &num_reads[i]));
+    }
+
+    for (int i = 0; i < NUM_SAMPLES; i++)
+    {
+        package[0] = (double)(i + WINDOW_SIZE);
+        auto start = steady_clock::now ();
+        db.add_data ((double)i, package);
+        auto stop = steady_clock::now ();
+        latencies[i] = duration_cast<nanoseconds> (stop - start).count ();
+    }
+
+    keep_alive = false;
+    long long total_reads = 0;
+    for (int i = 0; i < num_readers; i++)
+    {
+        readers[i].join ();
+        total_reads += num_reads[i];
+    }
+
+    sort (latencies.begin (), latencies.end ());
+    cout << num_readers << "," << latencies[NUM_SAMPLES / 2] << ","
+         << latencies[(size_t)(NUM_SAMPLES * 0.99)] << ","
+         << latencies[(size_t)(NUM_SAMPLES * 0.999)] << "," << latencies[NUM_SAMPLES - 1] << ","
+         << total_reads << endl;
+}
+
+void reader_thread (DataBuffer *db, volatile bool *keep_alive, long long *num_reads)
+{
+    vector<double> ts_buf (WINDOW_SIZE);
+    vector<double> data_buf (WINDOW_SIZE * NUM_CHANNELS);
+    while (*keep_alive)
+    {
+        size_t count = db->get_current_data (WINDOW_SIZE, ts_buf.data (), data_buf.data ());
+        // check that snapshot is consistent: counters in package should be sequential
+        for (size_t i = 1; i < count; i++)
+        {
+            if (data_buf[i * NUM_CHANNELS] != data_buf[(i - 1) * NUM_CHANNELS] + 1.0)
+            {
+                cerr << "inconsistent snapshot" << endl;
+                break;
+            }
+        }
+        (*num_reads)++;
+    }
+}
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <iostream>
+#include <math.h>
+#include <vector>
+
+#include "dsp_kernels.h"
+#include "fft_plan_cache.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// compares fft with FFTReal object and buffers created for each call(how perform_fft did it before)
+// with fft using cached plan for typical nfft values, also compares hanning window + psd scaling
+// calculated in place with cached window and vectorized kernels
+#define NUM_ITERATIONS 20000
+
+
+double fft_without_cache (const vector<double> &data, int nfft, vector<double> &output);
+double fft_with_cache (const vector<double> &data, int nfft, vector<double> &output);
+double window_psd_scalar (const vector<double> &data, int nfft, vector<double> &output);
+double window_psd_kernels (const vector<double> &data, int nfft, vector<double> &output);
+
+
+int main (int argc, char *argv[])
+{
+    cout << "nfft,no_cache_ns,cache_ns,window_psd_scalar_ns,window_psd_kernels_ns" << endl;
+    for (int nfft = 256; nfft <= 4096; nfft *= 2)
+    {
+        vector<double> data (nfft);
+        for (int i = 0; i < nfft; i++)
+        {
+            data[i] = sin (0.1 * i) + 0.5 * cos (0.37 * i);
+        }
+        vector<double> output (nfft);
+        double no_cache_ns = fft_without_cache (data, nfft, output);
+        double cache_ns = fft_with_cache (data, nfft, output);
+        double scalar_ns = window_psd_scalar (data, nfft, output);
+        double kernels_ns = window_psd_kernels (data, nfft, output);
+        cout << nfft << "," << no_cache_ns << "," << cache_ns << "," << scalar_ns << ","
+             << kernels_ns << endl;
+    }
+    return 0;
+}
+
+double fft_without_cache (const vector<double> &data, int nfft, vector<double> &output)
+{
+    auto start = high_resolution_clock::now ();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        double *windowed_data = new double[nfft];
+        double *temp = new double[nfft];
+        for (int i = 0; i < nfft; i++)
+        {
+            windowed_data[i] = data[i];
+        }
+        ffft::FFTReal<double> fft_object (nfft);
+        fft_object.do_fft (temp, windowed_data);
+        output[iter % nfft] = temp[iter % nfft];
+        delete[] temp;
+        delete[] windowed_data;
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<nanoseconds> (stop - start).count () / NUM_ITERATIONS;
+}
+
+double fft_with_cache (const vector<double> &data, int nfft, vector<double> &output)
+{
+    auto start = high_resolution_clock::now ();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        FFTPlan *plan = get_fft_plan (nfft);
+        double *windowed_data = plan->windowed_data.data ();
+        for (int i = 0; i < nfft; i++)
+        {
+            windowed_data[i] = data[i];
+        }
+        plan->fft.do_fft (plan->temp.data (), windowed_data);
+        output[iter % nfft] = plan->temp[iter % nfft];
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<nanoseconds> (stop - start).count () / NUM_ITERATIONS;
+}
+
+// fft itself is excluded, re and im are taken from windowed data to keep the same memory traffic
+double window_psd_scalar (const vector<double> &data, int nfft, vector<double> &output)
+{
+    vector<double> windowed_data (nfft);
+    auto start = high_resolution_clock::now ();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        for (int i = 0; i < nfft; i++)
+        {
+            windowed_data[i] = data[i] * (0.5 - 0.5 * cos (2.0 * M_PI * i / nfft));
+        }
+        const double *re = windowed_data.data ();
+        const double *im = windowed_data.data () + nfft / 2;
+        for (int i = 0; i < nfft / 2; i++)
+        {
+            output[i] = (re[i] * re[i] + im[i] * im[i]) / ((double)(250 * nfft));
+        }
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<nanoseconds> (stop - start).count () / NUM_ITERATIONS;
+}
+
+double window_psd_kernels (const vector<double> &data, int nfft, vector<double> &output)
+{
+    FFTPlan *plan = get_fft_plan (nfft);
+    double *windowed_data = plan->windowed_data.data ();
+    auto start = high_resolution_clock::now ();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        apply_window (
+            data.data (), plan->get_window (WindowFunctions::HANNING), windowed_data, nfft);
+        power_spectrum (windowed_data, windowed_data + nfft / 2, output.data (), nfft / 2,
+            (double)(250 * nfft));
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<nanoseconds> (stop - start).count () / NUM_ITERATIONS;
+}
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "data_buffer.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// compares reading of the latest window via temporary arrays + reshaping(how Board did it before)
+// with reading directly to the output table for both buffer layouts, also measures add_data
+#define BUFFER_SIZE 45000
+#define WINDOW_SIZE 2500
+#define NUM_ITERATIONS 200
+
+
+double fill_buffer (DataBuffer *db, int num_rows);
+double read_with_reshape (DataBuffer *db, int num_rows, double *output_buf);
+double read_direct (DataBuffer *db, int num_rows, double *output_buf);
+
+
+int main (int argc, char *argv[])
+{
+    int rows[3] = {8, 32, 256};
+    cout << "rows,reshape_us,direct_interleaved_us,direct_by_channels_us,add_interleaved_ns,"
+            "add_by_channels_ns"
+         << endl;
+    for (int r = 0; r < 3; r++)
+    {
+        int num_rows = rows[r];
+        int num_channels = num_rows - 1; // last row is for timestamps
+        DataBuffer interleaved (num_channels, BUFFER_SIZE, BufferLayouts::INTERLEAVED);
+        DataBuffer by_channels (num_channels, BUFFER_SIZE, BufferLayouts::BY_CHANNELS);
+        double add_interleaved_ns = fill_buffer (&interleaved, num_rows);
+        double add_by_channels_ns = fill_buffer (&by_channels, num_rows);
+        vector<double> output_buf (num_rows * WINDOW_SIZE);
+        double reshape_us = read_with_reshape (&interleaved, num_rows, output_buf.data ());
+        double interleaved_us = read_direct (&interleaved, num_rows, output_buf.data ());
+        double by_channels_us = read_direct (&by_channels, num_rows, output_buf.data ());
+        cout << num_rows << "," << reshape_us << "," << interleaved_us << "," << by_channels_us
+             << "," << add_interleaved_ns << "," << add_by_channels_ns << endl;
+    }
+    return 0;
+}
+
+double fill_buffer (DataBuffer *db, int num_rows)
+{
+    int num_channels = num_rows - 1;
+    int num_samples = BUFFER_SIZE + BUFFER_SIZE / 2;
+    vector<double> package (num_channels);
+    // start from the middle of ring to make sure that some reads cross ring boundary
+    auto start = high_resolution_clock::now ();
+    for (int i = 0; i < num_samples; i++)
+    {
+        for (int j = 0; j < num_channels; j++)
+        {
+            package[j] = (double)(i + j);
+        }
+        db->add_data ((double)i, package.data ());
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<nanoseconds> (stop - start).count () / num_samples;
+}
+
+double read_with_reshape (DataBuffer *db, int num_rows, double *output_buf)
+{
+    int num_channels = num_rows - 1;
+    auto start = high_resolution_clock::now ();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        double *buf = new double[WINDOW_SIZE * num_channels];
+        double *ts_buf = new double[WINDOW_SIZE];
+        int count = (int)db->get_current_data (WINDOW_SIZE, ts_buf, buf);
+        for (int i = 0; i < count; i++)
+        {
+            for (int j = 0; j < num_channels; j++)
+            {
+                output_buf[j * count + i] = buf[i * num_channels + j];
+            }
+        }
+        for (int i = 0; i < count; i++)
+        {
+            output_buf[num_channels * count + i] = ts_buf[i];
+        }
+        delete[] buf;
+        delete[] ts_buf;
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<microseconds> (stop - start).count () / NUM_ITERATIONS;
+}
+
+double read_direct (DataBuffer *db, int num_rows, double *output_buf)
+{
+    auto start = high_resolution_clock::now ();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        db->get_current_data (WINDOW_SIZE, output_buf);
+    }
+    auto stop = high_resolution_clock::now ();
+    return (double)duration_cast<microseconds> (stop - start).count () / NUM_ITERATIONS;
+}
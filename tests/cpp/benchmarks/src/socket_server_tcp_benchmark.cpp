@@ -0,0 +1,209 @@
+#include <arpa/inet.h>
+#include <chrono>
+#include <iostream>
+#include <netinet/in.h>
+#include <queue>
+#include <string.h>
+#include <sys/socket.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "socket_server_tcp.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// sends cyton packages over loopback tcp and compares reading them via std::queue<char>(how
+// SocketServerTCP::recv did it before) with peek_packet of SocketServerTCP. Reports throughput
+// and cpu time of receiving thread per MB
+#define PACKAGE_SIZE 33
+#define NUM_PACKAGES 2000000
+#define START_BYTE 0xA0
+#define END_BYTE 0xC0
+#define LOCAL_IP "127.0.0.1"
+#define PORT_QUEUE 17001
+#define PORT_RING 17002
+
+
+struct Result
+{
+    double mb_per_sec;
+    double cpu_ms_per_mb;
+    long long num_packages;
+};
+
+void sender_thread (int port);
+Result read_with_queue ();
+Result read_with_peek_packet ();
+double get_thread_cpu_ms ();
+Result get_result (double wall_sec, double cpu_ms, long long num_packages);
+
+
+int main (int argc, char *argv[])
+{
+    cout << "method,mb_per_sec,cpu_ms_per_mb,packages" << endl;
+    Result queue_result = read_with_queue ();
+    cout << "queue," << queue_result.mb_per_sec << "," << queue_result.cpu_ms_per_mb << ","
+         << queue_result.num_packages << endl;
+    Result ring_result = read_with_peek_packet ();
+    cout << "peek_packet," << ring_result.mb_per_sec << "," << ring_result.cpu_ms_per_mb << ","
+         << ring_result.num_packages << endl;
+    return 0;
+}
+
+void sender_thread (int port)
+{
+    int sock = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    struct sockaddr_in addr;
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons (port);
+    inet_pton (AF_INET, LOCAL_IP, &addr.sin_addr);
+    for (int i = 0; i < 100; i++)
+    {
+        if (connect (sock, (const struct sockaddr *)&addr, sizeof (addr)) == 0)
+        {
+            break;
+        }
+        this_thread::sleep_for (milliseconds (10));
+    }
+    // wifi shield sends several packages per tcp write
+    const int packages_per_write = 20;
+    vector<unsigned char> chunk (PACKAGE_SIZE * packages_per_write, 0);
+    for (int i = 0; i < NUM_PACKAGES; i += packages_per_write)
+    {
+        for (int j = 0; j < packages_per_write; j++)
+        {
+            chunk[j * PACKAGE_SIZE] = START_BYTE;
+            chunk[j * PACKAGE_SIZE + 1] = (unsigned char)(i + j);
+            chunk[j * PACKAGE_SIZE + PACKAGE_SIZE - 1] = END_BYTE;
+        }
+        size_t sent = 0;
+        while (sent < chunk.size ())
+        {
+            ssize_t res = send (sock, chunk.data () + sent, chunk.size () - sent, 0);
+            if (res <= 0)
+            {
+                close (sock);
+                return;
+            }
+            sent += (size_t)res;
+        }
+    }
+    close (sock);
+}
+
+Result read_with_queue ()
+{
+    int server = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    int value = 1;
+    setsockopt (server, SOL_SOCKET, SO_REUSEADDR, &value, sizeof (value));
+    struct sockaddr_in addr;
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons (PORT_QUEUE);
+    inet_pton (AF_INET, LOCAL_IP, &addr.sin_addr);
+    bind (server, (const struct sockaddr *)&addr, sizeof (addr));
+    listen (server, 1);
+    thread sender (sender_thread, PORT_QUEUE);
+    int client = accept (server, NULL, NULL);
+
+    queue<char> temp_buffer;
+    unsigned char b[PACKAGE_SIZE];
+    long long num_packages = 0;
+    auto start = high_resolution_clock::now ();
+    double cpu_start = get_thread_cpu_ms ();
+    while (true)
+    {
+        int res = (int)recv (client, b, PACKAGE_SIZE, 0);
+        if (res <= 0)
+        {
+            break;
+        }
+        for (int i = 0; i < res; i++)
+        {
+            temp_buffer.push (((char *)b)[i]);
+        }
+        if (temp_buffer.size () < PACKAGE_SIZE)
+        {
+            continue;
+        }
+        for (int i = 0; i < PACKAGE_SIZE; i++)
+        {
+            ((char *)b)[i] = temp_buffer.front ();
+            temp_buffer.pop ();
+        }
+        if ((b[0] == START_BYTE) && (b[PACKAGE_SIZE - 1] == END_BYTE))
+        {
+            num_packages++;
+        }
+    }
+    double cpu_ms = get_thread_cpu_ms () - cpu_start;
+    double wall_sec = duration<double> (high_resolution_clock::now () - start).count ();
+    sender.join ();
+    close (client);
+    close (server);
+    return get_result (wall_sec, cpu_ms, num_packages);
+}
+
+Result read_with_peek_packet ()
+{
+    SocketServerTCP server (LOCAL_IP, PORT_RING, true);
+    server.bind ();
+    server.accept ();
+    thread sender (sender_thread, PORT_RING);
+    while (!server.client_connected)
+    {
+        this_thread::sleep_for (milliseconds (1));
+    }
+
+    long long num_packages = 0;
+    auto start = high_resolution_clock::now ();
+    double cpu_start = get_thread_cpu_ms ();
+    while (true)
+    {
+        const unsigned char *package = NULL;
+        int res = server.peek_packet (START_BYTE, PACKAGE_SIZE, &package);
+        if (res < 0)
+        {
+            break;
+        }
+        if (res == 0)
+        {
+            // connection is closed by sender and all packages are read
+            if (num_packages == NUM_PACKAGES)
+            {
+                break;
+            }
+            continue;
+        }
+        if (package[PACKAGE_SIZE - 1] == END_BYTE)
+        {
+            num_packages++;
+        }
+        server.consume (PACKAGE_SIZE);
+    }
+    double cpu_ms = get_thread_cpu_ms () - cpu_start;
+    double wall_sec = duration<double> (high_resolution_clock::now () - start).count ();
+    sender.join ();
+    return get_result (wall_sec, cpu_ms, num_packages);
+}
+
+double get_thread_cpu_ms ()
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+Result get_result (double wall_sec, double cpu_ms, long long num_packages)
+{
+    double mb = (double)num_packages * PACKAGE_SIZE / (1024.0 * 1024.0);
+    Result result;
+    result.mb_per_sec = mb / wall_sec;
+    result.cpu_ms_per_mb = cpu_ms / mb;
+    result.num_packages = num_packages;
+    return result;
+}
@@ -0,0 +1,167 @@
+#include <arpa/inet.h>
+#include <chrono>
+#include <iostream>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "datagram_batch.h"
+#include "socket_client_udp.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// loopback load test for udp boards: sender thread plays the role of the board(like
+// emulator/brainflow_emulator/galea_udp.py but sends galea sized datagrams in bursts at
+// SEND_RATE) and receiver reads them with recv per datagram(how boards did it before) or with
+// recv_batch. Reports received packets per second, drop rate and cpu time of receiving thread
+#define DATAGRAM_SIZE 1368 // Galea::transaction_size
+#define NUM_DATAGRAMS 200000
+#define SEND_RATE 50000 // datagrams per second
+#define BURST_SIZE 32
+#define BATCH_SIZE 16
+#define LOCAL_IP "127.0.0.1"
+#define BOARD_PORT 17011
+
+
+struct Result
+{
+    double packets_per_sec;
+    double drop_rate;
+    double cpu_us_per_packet;
+};
+
+void sender_thread (int sock, int port);
+int create_board_socket ();
+Result read_with_recv ();
+Result read_with_recv_batch ();
+double get_thread_cpu_ms ();
+void print_result (const char *method, Result result);
+
+
+int main (int argc, char *argv[])
+{
+    cout << "method,packets_per_sec,drop_rate,cpu_us_per_packet" << endl;
+    print_result ("recv", read_with_recv ());
+    print_result ("recv_batch", read_with_recv_batch ());
+    return 0;
+}
+
+// socket of the board is bound before the receiver connects to it
+int create_board_socket ()
+{
+    int sock = socket (AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    int value = 1;
+    setsockopt (sock, SOL_SOCKET, SO_REUSEADDR, &value, sizeof (value));
+    struct sockaddr_in addr;
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons (BOARD_PORT);
+    inet_pton (AF_INET, LOCAL_IP, &addr.sin_addr);
+    bind (sock, (const struct sockaddr *)&addr, sizeof (addr));
+    return sock;
+}
+
+void sender_thread (int sock, int port)
+{
+    struct sockaddr_in addr;
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons (port);
+    inet_pton (AF_INET, LOCAL_IP, &addr.sin_addr);
+    vector<unsigned char> datagram (DATAGRAM_SIZE, 0);
+    auto start = high_resolution_clock::now ();
+    for (int i = 0; i < NUM_DATAGRAMS; i++)
+    {
+        if ((i % BURST_SIZE) == 0)
+        {
+            this_thread::sleep_until (start + microseconds ((long long)i * 1000000 / SEND_RATE));
+        }
+        memcpy (datagram.data (), &i, sizeof (i));
+        sendto (sock, datagram.data (), datagram.size (), 0, (const struct sockaddr *)&addr,
+            sizeof (addr));
+    }
+}
+
+// receiver stops after 1 second without data
+Result read_with_recv ()
+{
+    int board_socket = create_board_socket ();
+    SocketClientUDP client (LOCAL_IP, BOARD_PORT);
+    client.connect ();
+    client.set_timeout (1);
+    thread sender (sender_thread, board_socket, client.get_local_port ());
+
+    vector<unsigned char> datagram (DATAGRAM_SIZE);
+    long long num_packets = 0;
+    double cpu_start = get_thread_cpu_ms ();
+    auto start = high_resolution_clock::now ();
+    auto last = start;
+    while (client.recv (datagram.data (), DATAGRAM_SIZE) == DATAGRAM_SIZE)
+    {
+        num_packets++;
+        last = high_resolution_clock::now ();
+    }
+    double cpu_ms = get_thread_cpu_ms () - cpu_start;
+    sender.join ();
+    close (board_socket);
+
+    Result result;
+    result.packets_per_sec = num_packets / duration<double> (last - start).count ();
+    result.drop_rate = 1.0 - (double)num_packets / NUM_DATAGRAMS;
+    result.cpu_us_per_packet = cpu_ms * 1000.0 / num_packets;
+    return result;
+}
+
+Result read_with_recv_batch ()
+{
+    int board_socket = create_board_socket ();
+    SocketClientUDP client (LOCAL_IP, BOARD_PORT);
+    client.connect ();
+    client.set_timeout (1);
+    thread sender (sender_thread, board_socket, client.get_local_port ());
+
+    DatagramBatch batch (BATCH_SIZE, DATAGRAM_SIZE);
+    long long num_packets = 0;
+    double cpu_start = get_thread_cpu_ms ();
+    auto start = high_resolution_clock::now ();
+    auto last = start;
+    int res = 0;
+    while ((res = client.recv_batch (&batch)) > 0)
+    {
+        for (int i = 0; i < res; i++)
+        {
+            if (batch.get_datagram_size (i) == DATAGRAM_SIZE)
+            {
+                num_packets++;
+            }
+        }
+        last = high_resolution_clock::now ();
+    }
+    double cpu_ms = get_thread_cpu_ms () - cpu_start;
+    sender.join ();
+    close (board_socket);
+
+    Result result;
+    result.packets_per_sec = num_packets / duration<double> (last - start).count ();
+    result.drop_rate = 1.0 - (double)num_packets / NUM_DATAGRAMS;
+    result.cpu_us_per_packet = cpu_ms * 1000.0 / num_packets;
+    return result;
+}
+
+double get_thread_cpu_ms ()
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+void print_result (const char *method, Result result)
+{
+    cout << method << "," << result.packets_per_sec << "," << result.drop_rate << ","
+         << result.cpu_us_per_packet << endl;
+}
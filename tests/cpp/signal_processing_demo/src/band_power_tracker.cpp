@@ -0,0 +1,122 @@
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "board_shim.h"
+#include "data_filter.h"
+
+using namespace std;
+
+
+int main (int argc, char *argv[])
+{
+    struct BrainFlowInputParams params;
+    // use synthetic board for demo
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+
+    BoardShim::enable_dev_board_logger ();
+    DataFilter::enable_dev_data_logger ();
+
+    BoardShim *board = new BoardShim (board_id, params);
+    double **data = NULL;
+    std::pair<double *, double *> expected (NULL, NULL);
+    std::pair<double *, double *> actual (NULL, NULL);
+    int *eeg_channels = NULL;
+    int num_rows = 0;
+    int res = 0;
+    int sampling_rate = BoardShim::get_sampling_rate (board_id);
+
+    try
+    {
+        board->prepare_session ();
+        board->start_stream ();
+        BoardShim::log_message ((int)LogLevels::LEVEL_INFO, "Start sleeping in the main thread");
+#ifdef _WIN32
+        Sleep (10000);
+#else
+        sleep (10);
+#endif
+
+        board->stop_stream ();
+        int data_count = 0;
+        data = board->get_board_data (&data_count);
+        board->release_session ();
+        num_rows = BoardShim::get_num_rows (board_id);
+
+        int eeg_num_channels = 0;
+        eeg_channels = BoardShim::get_eeg_channels (board_id, &eeg_num_channels);
+        int window_size = 4 * sampling_rate;
+        if (data_count < window_size)
+        {
+            throw BrainFlowException (
+                "not enough data", (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR);
+        }
+        // get_avg_band_powers uses all passed datapoints, so pass only the first window
+        expected = DataFilter::get_avg_band_powers (
+            data, window_size, eeg_channels, eeg_num_channels, sampling_rate, false);
+
+        // tracker processes each chunk only once, after window_size datapoints it should return
+        // the same values as get_avg_band_powers for this window. With apply_filters set results
+        // are close but not equal, tracker can not detrend the whole window
+        int tracker_id = DataFilter::create_band_power_tracker (
+            eeg_num_channels, sampling_rate, window_size, false);
+        double **chunk = new double *[num_rows];
+        int chunk_size = 37;
+        for (int i = 0; i < window_size; i += chunk_size)
+        {
+            int len = (window_size - i < chunk_size) ? window_size - i : chunk_size;
+            for (int j = 0; j < num_rows; j++)
+            {
+                chunk[j] = data[j] + i;
+            }
+            DataFilter::add_band_power_tracker_data (
+                tracker_id, chunk, len, eeg_channels, eeg_num_channels);
+        }
+        delete[] chunk;
+        actual = DataFilter::get_band_power_tracker_values (tracker_id);
+        DataFilter::release_band_power_tracker (tracker_id);
+
+        double max_diff = 0.0;
+        for (int i = 0; i < 5; i++)
+        {
+            double avg_diff = fabs (actual.first[i] - expected.first[i]);
+            double stddev_diff = fabs (actual.second[i] - expected.second[i]);
+            max_diff = (avg_diff > max_diff) ? avg_diff : max_diff;
+            max_diff = (stddev_diff > max_diff) ? stddev_diff : max_diff;
+        }
+        std::cout << "max diff between tracker and get_avg_band_powers:" << max_diff << std::endl;
+        // fail test if tracker doesnt match get_avg_band_powers
+        if (max_diff > 1e-9)
+        {
+            res = -1;
+        }
+    }
+    catch (const BrainFlowException &err)
+    {
+        BoardShim::log_message ((int)LogLevels::LEVEL_ERROR, err.what ());
+        res = err.exit_code;
+    }
+
+    if (data != NULL)
+    {
+        for (int i = 0; i < num_rows; i++)
+        {
+            delete[] data[i];
+        }
+    }
+    delete[] data;
+    delete[] expected.first;
+    delete[] expected.second;
+    delete[] actual.first;
+    delete[] actual.second;
+    delete[] eeg_channels;
+    delete board;
+
+    return res;
+}
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "board_shim.h"
+
+using namespace std;
+
+// appends timestamps of new samples for reader, returns number of samples
+int read_timestamps (BoardShim *board, int reader_id, int max_samples, int timestamp_channel,
+    int num_rows, vector<double> &timestamps);
+
+
+int main (int argc, char *argv[])
+{
+    struct BrainFlowInputParams params;
+    // use synthetic board for demo
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+
+    BoardShim::enable_dev_board_logger ();
+
+    BoardShim *board = new BoardShim (board_id, params);
+    double **data = NULL;
+    int num_rows = BoardShim::get_num_rows (board_id);
+    int timestamp_channel = BoardShim::get_timestamp_channel (board_id);
+    int res = 0;
+
+    try
+    {
+        board->prepare_session ();
+        board->start_stream ();
+        // readers dont remove data from ringbuffer, they get only samples collected after creation
+        int fast_reader = board->create_reader ();
+        int slow_reader = board->create_reader ();
+        vector<double> fast_timestamps;
+        vector<double> slow_timestamps;
+        BoardShim::log_message ((int)LogLevels::LEVEL_INFO, "Start reading in the main thread");
+        for (int i = 0; i < 50; i++)
+        {
+#ifdef _WIN32
+            Sleep (100);
+#else
+            usleep (100000);
+#endif
+            // fast reader gets less than sampling rate and falls behind, slow reader gets
+            // everything but rarely
+            read_timestamps (
+                board, fast_reader, 10, timestamp_channel, num_rows, fast_timestamps);
+            if (i % 10 == 9)
+            {
+                read_timestamps (
+                    board, slow_reader, 10000, timestamp_channel, num_rows, slow_timestamps);
+            }
+        }
+        board->stop_stream ();
+        // get samples which are left in ringbuffer after stop_stream
+        int num_new = 0;
+        do
+        {
+            num_new = read_timestamps (
+                board, fast_reader, 10, timestamp_channel, num_rows, fast_timestamps);
+            num_new += read_timestamps (
+                board, slow_reader, 10000, timestamp_channel, num_rows, slow_timestamps);
+        } while (num_new > 0);
+        board->release_reader (fast_reader);
+        board->release_reader (slow_reader);
+
+        int data_count = 0;
+        data = board->get_board_data (&data_count);
+        board->release_session ();
+
+        std::cout << "fast reader: " << fast_timestamps.size ()
+                  << " slow reader: " << slow_timestamps.size ()
+                  << " board data: " << data_count << std::endl;
+        // fail test if readers missed or duplicated samples, readers were created after
+        // start_stream so they should get the tail of board data
+        int num_read = (int)fast_timestamps.size ();
+        if ((num_read == 0) || (num_read > data_count) || (fast_timestamps != slow_timestamps))
+        {
+            res = -1;
+        }
+        for (int i = 0; (res == 0) && (i < num_read); i++)
+        {
+            if (fast_timestamps[i] != data[timestamp_channel][data_count - num_read + i])
+            {
+                res = -1;
+            }
+        }
+    }
+    catch (const BrainFlowException &err)
+    {
+        BoardShim::log_message ((int)LogLevels::LEVEL_ERROR, err.what ());
+        res = err.exit_code;
+    }
+
+    if (data != NULL)
+    {
+        for (int i = 0; i < num_rows; i++)
+        {
+            delete[] data[i];
+        }
+    }
+    delete[] data;
+    delete board;
+
+    return res;
+}
+
+int read_timestamps (BoardShim *board, int reader_id, int max_samples, int timestamp_channel,
+    int num_rows, vector<double> &timestamps)
+{
+    int data_count = 0;
+    double **data = board->read_new_samples (reader_id, max_samples, &data_count);
+    for (int i = 0; i < data_count; i++)
+    {
+        timestamps.push_back (data[timestamp_channel][i]);
+    }
+    for (int i = 0; i < num_rows; i++)
+    {
+        delete[] data[i];
+    }
+    delete[] data;
+    return data_count;
+}
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "board_shim.h"
+#include "data_filter.h"
+
+using namespace std;
+
+double max_diff (double *first, double *second, int len);
+
+
+int main (int argc, char *argv[])
+{
+    struct BrainFlowInputParams params;
+    // use synthetic board for demo
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+
+    BoardShim::enable_dev_board_logger ();
+    DataFilter::enable_dev_data_logger ();
+
+    BoardShim *board = new BoardShim (board_id, params);
+    double **data = NULL;
+    double *expected = NULL;
+    double *repeated = NULL;
+    int *eeg_channels = NULL;
+    int num_rows = 0;
+    int res = 0;
+
+    try
+    {
+        board->prepare_session ();
+        board->start_stream ();
+        BoardShim::log_message ((int)LogLevels::LEVEL_INFO, "Start sleeping in the main thread");
+#ifdef _WIN32
+        Sleep (5000);
+#else
+        sleep (5);
+#endif
+
+        board->stop_stream ();
+        int data_count = 0;
+        data = board->get_board_data (&data_count);
+        board->release_session ();
+        num_rows = BoardShim::get_num_rows (board_id);
+
+        int eeg_num_channels = 0;
+        eeg_channels = BoardShim::get_eeg_channels (board_id, &eeg_num_channels);
+        expected = new double[eeg_num_channels * data_count];
+        for (int i = 0; i < eeg_num_channels; i++)
+        {
+            double *channel_data = expected + i * data_count;
+            memcpy (channel_data, data[eeg_channels[i]], sizeof (double) * data_count);
+            DataFilter::perform_wavelet_denoising (channel_data, data_count, (char *)"db4", 3);
+        }
+
+        // wavelet plans are cached for (wavelet, data_len, decomposition_level), reused plan
+        // should give the same result, other data len in between should not affect it
+        repeated = new double[data_count];
+        memcpy (repeated, data[eeg_channels[0]], sizeof (double) * data_count);
+        DataFilter::perform_wavelet_denoising (repeated, data_count - 1, (char *)"db4", 3);
+        memcpy (repeated, data[eeg_channels[0]], sizeof (double) * data_count);
+        DataFilter::perform_wavelet_denoising (repeated, data_count, (char *)"db4", 3);
+        double repeated_diff = max_diff (repeated, expected, data_count);
+
+        // channels are denoised in parallel, each channel should be the same as for single
+        // channel method
+        DataFilter::perform_wavelet_denoising_multi (
+            data, data_count, eeg_channels, eeg_num_channels, (char *)"db4", 3);
+        double multi_diff = 0.0;
+        for (int i = 0; i < eeg_num_channels; i++)
+        {
+            double diff = max_diff (data[eeg_channels[i]], expected + i * data_count, data_count);
+            multi_diff = (diff > multi_diff) ? diff : multi_diff;
+        }
+        std::cout << "max diff for repeated call:" << repeated_diff
+                  << " for multichannel denoising:" << multi_diff << std::endl;
+        // fail test if results are not identical
+        if ((repeated_diff != 0.0) || (multi_diff != 0.0))
+        {
+            res = -1;
+        }
+    }
+    catch (const BrainFlowException &err)
+    {
+        BoardShim::log_message ((int)LogLevels::LEVEL_ERROR, err.what ());
+        res = err.exit_code;
+    }
+
+    if (data != NULL)
+    {
+        for (int i = 0; i < num_rows; i++)
+        {
+            delete[] data[i];
+        }
+    }
+    delete[] data;
+    delete[] expected;
+    delete[] repeated;
+    delete[] eeg_channels;
+    delete board;
+
+    return res;
+}
+
+double max_diff (double *first, double *second, int len)
+{
+    double result = 0.0;
+    for (int i = 0; i < len; i++)
+    {
+        double diff = fabs (first[i] - second[i]);
+        result = (diff > result) ? diff : result;
+    }
+    return result;
+}
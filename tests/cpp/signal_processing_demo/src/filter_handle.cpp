@@ -0,0 +1,104 @@
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "board_shim.h"
+#include "data_filter.h"
+
+using namespace std;
+
+
+int main (int argc, char *argv[])
+{
+    struct BrainFlowInputParams params;
+    // use synthetic board for demo
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+
+    BoardShim::enable_dev_board_logger ();
+    DataFilter::enable_dev_data_logger ();
+
+    BoardShim *board = new BoardShim (board_id, params);
+    double **data = NULL;
+    double *expected = NULL;
+    int *eeg_channels = NULL;
+    int num_rows = 0;
+    int res = 0;
+    int sampling_rate = BoardShim::get_sampling_rate (board_id);
+
+    try
+    {
+        board->prepare_session ();
+        board->start_stream ();
+        BoardShim::log_message ((int)LogLevels::LEVEL_INFO, "Start sleeping in the main thread");
+#ifdef _WIN32
+        Sleep (5000);
+#else
+        sleep (5);
+#endif
+
+        board->stop_stream ();
+        int data_count = 0;
+        data = board->get_board_data (&data_count);
+        board->release_session ();
+        num_rows = BoardShim::get_num_rows (board_id);
+
+        int eeg_num_channels = 0;
+        eeg_channels = BoardShim::get_eeg_channels (board_id, &eeg_num_channels);
+        int channel = eeg_channels[1];
+        expected = new double[data_count];
+        memcpy (expected, data[channel], sizeof (double) * data_count);
+        DataFilter::perform_bandpass (expected, data_count, sampling_rate, 15.0, 6.0, 4,
+            (int)FilterTypes::BUTTERWORTH, 0);
+
+        // filter handle keeps its state between calls, so data can be filtered chunk by chunk as
+        // it comes from the board, result should be the same as for the whole array
+        int filter_id = DataFilter::create_filter ((int)FilterOperations::BANDPASS, sampling_rate,
+            15.0, 6.0, 4, (int)FilterTypes::BUTTERWORTH, 0);
+        int chunk_size = 37;
+        for (int i = 0; i < data_count; i += chunk_size)
+        {
+            int len = (data_count - i < chunk_size) ? data_count - i : chunk_size;
+            DataFilter::process_filter (filter_id, data[channel] + i, len);
+        }
+        DataFilter::release_filter (filter_id);
+
+        double max_diff = 0.0;
+        for (int i = 0; i < data_count; i++)
+        {
+            double diff = fabs (data[channel][i] - expected[i]);
+            max_diff = (diff > max_diff) ? diff : max_diff;
+        }
+        std::cout << "max diff between chunked and one-shot filter:" << max_diff << std::endl;
+        // fail test if filter handle doesnt match perform_bandpass
+        if (max_diff > 1e-9)
+        {
+            res = -1;
+        }
+    }
+    catch (const BrainFlowException &err)
+    {
+        BoardShim::log_message ((int)LogLevels::LEVEL_ERROR, err.what ());
+        res = err.exit_code;
+    }
+
+    if (data != NULL)
+    {
+        for (int i = 0; i < num_rows; i++)
+        {
+            delete[] data[i];
+        }
+    }
+    delete[] data;
+    delete[] expected;
+    delete[] eeg_channels;
+    delete board;
+
+    return res;
+}
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "board_shim.h"
+#include "data_filter.h"
+
+using namespace std;
+
+void free_table (double **data, int num_rows);
+
+
+int main (int argc, char *argv[])
+{
+    struct BrainFlowInputParams params;
+    // use synthetic board for demo
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+
+    BoardShim::enable_dev_board_logger ();
+
+    BoardShim *board = new BoardShim (board_id, params);
+    double **data = NULL;
+    double **first_file = NULL;
+    double **second_file = NULL;
+    int num_rows = BoardShim::get_num_rows (board_id);
+    int first_rows = 0;
+    int second_rows = 0;
+    int res = 0;
+
+    try
+    {
+        board->prepare_session ();
+        // several streamers are separated by ';', each of them gets all samples
+        board->start_stream (45000, (char *)"file://streamer_a.csv:w;file://streamer_b.csv:w");
+        BoardShim::log_message ((int)LogLevels::LEVEL_INFO, "Start sleeping in the main thread");
+#ifdef _WIN32
+        Sleep (3000);
+#else
+        sleep (3);
+#endif
+        board->stop_stream ();
+        int data_count = 0;
+        data = board->get_board_data (&data_count);
+
+        // if one of streamers is invalid stream should not be started
+        try
+        {
+            board->start_stream (45000, (char *)"file://streamer_c.csv:w;file:/streamer_d.csv");
+            std::cout << "stream was started with invalid streamer" << std::endl;
+            res = -1;
+        }
+        catch (const BrainFlowException &err)
+        {
+            if (err.exit_code != (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
+            {
+                res = -1;
+            }
+        }
+        board->release_session ();
+
+        int first_cols = 0;
+        int second_cols = 0;
+        first_file = DataFilter::read_file (&first_rows, &first_cols, (char *)"streamer_a.csv");
+        second_file = DataFilter::read_file (&second_rows, &second_cols, (char *)"streamer_b.csv");
+        std::cout << "board data: " << data_count << " first file: " << first_cols
+                  << " second file: " << second_cols << std::endl;
+        // fail test if files are different or dont contain all samples
+        if ((first_rows != num_rows) || (second_rows != num_rows) || (first_cols != data_count) ||
+            (second_cols != data_count))
+        {
+            res = -1;
+        }
+        for (int i = 0; (res == 0) && (i < num_rows); i++)
+        {
+            for (int j = 0; j < data_count; j++)
+            {
+                if (first_file[i][j] != second_file[i][j])
+                {
+                    res = -1;
+                    break;
+                }
+            }
+        }
+    }
+    catch (const BrainFlowException &err)
+    {
+        BoardShim::log_message ((int)LogLevels::LEVEL_ERROR, err.what ());
+        res = err.exit_code;
+    }
+
+    free_table (data, num_rows);
+    free_table (first_file, first_rows);
+    free_table (second_file, second_rows);
+    delete board;
+
+    return res;
+}
+
+void free_table (double **data, int num_rows)
+{
+    if (data != NULL)
+    {
+        for (int i = 0; i < num_rows; i++)
+        {
+            delete[] data[i];
+        }
+    }
+    delete[] data;
+}
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+
+#include "board_shim.h"
+#include "data_filter.h"
+
+using namespace std;
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// max difference between data and sine with amplitude 1, edges are skipped
+double max_sine_diff (double *data, int data_len, int sampling_rate, double freq, int skip);
+
+
+int main (int argc, char *argv[])
+{
+    DataFilter::enable_dev_data_logger ();
+
+    int res = 0;
+    double *data = NULL;
+    double *resampled_data = NULL;
+    double *decimated_data = NULL;
+    double *each_data = NULL;
+
+    try
+    {
+        // 10 Hz sine resampled from 200 Hz to 250 Hz should stay the same sine
+        int input_rate = 200;
+        int output_rate = 250;
+        int data_len = 4 * input_rate;
+        data = new double[data_len];
+        for (int i = 0; i < data_len; i++)
+        {
+            data[i] = sin (2.0 * M_PI * 10.0 * i / input_rate);
+        }
+        int resampled_len = 0;
+        resampled_data = DataFilter::perform_resampling (
+            data, data_len, input_rate, output_rate, &resampled_len);
+        double resampling_diff =
+            max_sine_diff (resampled_data, resampled_len, output_rate, 10.0, 50);
+        std::cout << "resampled len: " << resampled_len
+                  << " max diff with 10 Hz sine: " << resampling_diff << std::endl;
+        // fail test if amplitude or frequency changed
+        if ((resampled_len != data_len * output_rate / input_rate) || (resampling_diff > 0.01))
+        {
+            res = -1;
+        }
+        // output len is ceil (data_len * output_rate / input_rate)
+        for (int len = 1; len < 20; len++)
+        {
+            int expected_len = (len * output_rate + input_rate - 1) / input_rate;
+            if (DataFilter::get_resampled_len (len, input_rate, output_rate) != expected_len)
+            {
+                std::cout << "wrong resampled len for " << len << std::endl;
+                res = -1;
+            }
+        }
+        delete[] data;
+
+        // 5 Hz sine with 40 Hz noise, after decimation from 250 Hz to 50 Hz noise is above the
+        // new Nyquist frequency, FIR decimation removes it while EACH folds it to 10 Hz
+        int period = 5;
+        input_rate = 250;
+        data_len = 4 * input_rate;
+        data = new double[data_len];
+        for (int i = 0; i < data_len; i++)
+        {
+            data[i] = sin (2.0 * M_PI * 5.0 * i / input_rate) +
+                0.5 * sin (2.0 * M_PI * 40.0 * i / input_rate);
+        }
+        int decimated_len = 0;
+        decimated_data = DataFilter::perform_downsampling (
+            data, data_len, period, (int)AggOperations::FIR_DECIMATION, &decimated_len);
+        int each_len = 0;
+        each_data = DataFilter::perform_downsampling (
+            data, data_len, period, (int)AggOperations::EACH, &each_len);
+        double decimation_diff =
+            max_sine_diff (decimated_data, decimated_len, input_rate / period, 5.0, 10);
+        double each_diff = max_sine_diff (each_data, each_len, input_rate / period, 5.0, 10);
+        std::cout << "max diff with 5 Hz sine, fir decimation: " << decimation_diff
+                  << " each: " << each_diff << std::endl;
+        // fail test if 40 Hz is not attenuated
+        if ((decimated_len != data_len / period) || (decimation_diff > 0.05) || (each_diff < 0.4))
+        {
+            res = -1;
+        }
+    }
+    catch (const BrainFlowException &err)
+    {
+        BoardShim::log_message ((int)LogLevels::LEVEL_ERROR, err.what ());
+        res = err.exit_code;
+    }
+
+    delete[] data;
+    delete[] resampled_data;
+    delete[] decimated_data;
+    delete[] each_data;
+
+    return res;
+}
+
+double max_sine_diff (double *data, int data_len, int sampling_rate, double freq, int skip)
+{
+    double max_diff = 0.0;
+    for (int i = skip; i < data_len - skip; i++)
+    {
+        double diff = fabs (data[i] - sin (2.0 * M_PI * freq * i / sampling_rate));
+        max_diff = (diff > max_diff) ? diff : max_diff;
+    }
+    return max_diff;
+}
@@ -0,0 +1,47 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds
+from brainflow.data_filter import DataFilter
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    sampling_rate = BoardShim.get_sampling_rate (board_id)
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    board.start_stream ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (10)
+    data = board.get_board_data ()
+    board.stop_stream ()
+    board.release_session ()
+
+    eeg_channels = BoardShim.get_eeg_channels (board_id)
+    window_size = 4 * sampling_rate
+    if data.shape[1] < window_size:
+        raise ValueError ('not enough data: %d samples' % data.shape[1])
+    # get_avg_band_powers uses all passed datapoints, so pass only the first window
+    expected = DataFilter.get_avg_band_powers (data[:, :window_size], eeg_channels, sampling_rate, False)
+    # tracker processes each chunk only once, after window_size datapoints it should return the same values
+    # as get_avg_band_powers for this window. With apply_filter set results are close but not equal,
+    # tracker can not detrend the whole window
+    tracker_id = DataFilter.create_band_power_tracker (len (eeg_channels), sampling_rate, window_size, False)
+    chunk_size = 37
+    for i in range (0, window_size, chunk_size):
+        DataFilter.add_band_power_tracker_data (tracker_id, data[:, i:min (i + chunk_size, window_size)], eeg_channels)
+    actual = DataFilter.get_band_power_tracker_values (tracker_id)
+    DataFilter.release_band_power_tracker (tracker_id)
+    if (not np.allclose (actual[0], expected[0])) or (not np.allclose (actual[1], expected[1])):
+        raise ValueError ('band power tracker doesnt match get_avg_band_powers')
+    print ('band power tracker matches get_avg_band_powers')
+
+
+if __name__ == "__main__":
+    main ()
@@ -0,0 +1,58 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    timestamp_channel = BoardShim.get_timestamp_channel (board_id)
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    board.start_stream ()
+    # readers dont remove data from ringbuffer, they get only samples collected after creation
+    fast_reader = board.create_reader ()
+    slow_reader = board.create_reader ()
+    fast_timestamps = list ()
+    slow_timestamps = list ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start reading in the main thread')
+    for i in range (50):
+        time.sleep (0.1)
+        # fast reader gets less than sampling rate and falls behind, slow reader gets everything but rarely
+        fast_timestamps.extend (board.read_new_samples (fast_reader, 10)[timestamp_channel])
+        if i % 10 == 9:
+            slow_timestamps.extend (board.read_new_samples (slow_reader, 10000)[timestamp_channel])
+    board.stop_stream ()
+    # get samples which are left in ringbuffer after stop_stream
+    while True:
+        fast_data = board.read_new_samples (fast_reader, 10)
+        slow_data = board.read_new_samples (slow_reader, 10000)
+        fast_timestamps.extend (fast_data[timestamp_channel])
+        slow_timestamps.extend (slow_data[timestamp_channel])
+        if fast_data.shape[1] == 0 and slow_data.shape[1] == 0:
+            break
+    board.release_reader (fast_reader)
+    board.release_reader (slow_reader)
+    data = board.get_board_data ()
+    board.release_session ()
+
+    print ('fast reader: %d slow reader: %d board data: %d' % (len (fast_timestamps), len (slow_timestamps), data.shape[1]))
+    # readers were created after start_stream so they should get the tail of board data
+    num_read = len (fast_timestamps)
+    if num_read == 0 or num_read > data.shape[1]:
+        raise ValueError ('wrong number of samples from readers')
+    if fast_timestamps != slow_timestamps:
+        raise ValueError ('readers got different samples')
+    if not np.array_equal (np.array (fast_timestamps), data[timestamp_channel][data.shape[1] - num_read:]):
+        raise ValueError ('readers missed or duplicated samples')
+    print ('each reader got every sample once')
+
+
+if __name__ == "__main__":
+    main ()
@@ -0,0 +1,46 @@
+import argparse
+import time
+import json
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds, BufferLayouts
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    package_num_channel = BoardShim.get_package_num_channel (board_id)
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    # with BY_CHANNELS each channel is stored contiguously, output format is the same
+    board.set_buffer_layout (BufferLayouts.BY_CHANNELS.value)
+    board.start_stream ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (5)
+    board.stop_stream ()
+    stats = json.loads (board.get_board_stats ())
+    data = board.get_board_data ()
+    board.release_session ()
+
+    print (stats)
+    # synthetic board doesnt lose packages, all samples are still in ringbuffer
+    if stats['num_samples'] != data.shape[1] or data.shape[1] == 0:
+        raise ValueError ('wrong number of samples in stats')
+    for counter in ('num_gaps', 'num_lost_samples', 'num_duplicates', 'num_out_of_order', 'num_decode_errors'):
+        if stats[counter] != 0:
+            raise ValueError ('unexpected %s: %d' % (counter, stats[counter]))
+    if stats['mean_interval'] <= 0 or stats['max_interval'] < stats['mean_interval']:
+        raise ValueError ('wrong sampling intervals')
+    # package num for synthetic board is increased by one for each sample
+    package_nums = data[package_num_channel]
+    if not np.array_equal ((package_nums[1:] - package_nums[:-1]) % 256, np.ones (data.shape[1] - 1)):
+        raise ValueError ('samples from BY_CHANNELS buffer are not in order')
+    print ('board stats match board data')
+
+
+if __name__ == "__main__":
+    main ()
@@ -0,0 +1,47 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds
+from brainflow.data_filter import DataFilter
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    board.start_stream ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (5)
+    data = board.get_board_data ()
+    board.stop_stream ()
+    board.release_session ()
+
+    eeg_channels = BoardShim.get_eeg_channels (board_id)
+    expected = np.copy (data[eeg_channels])
+    for i in range (len (eeg_channels)):
+        DataFilter.perform_wavelet_denoising (expected[i], 'db4', 3)
+
+    # wavelet plans are cached for (wavelet, data_len, decomposition_level), reused plan should give the same result,
+    # other data len in between should not affect it
+    repeated = np.copy (data[eeg_channels[0]])
+    DataFilter.perform_wavelet_denoising (repeated[:-1], 'db4', 3)
+    repeated = np.copy (data[eeg_channels[0]])
+    DataFilter.perform_wavelet_denoising (repeated, 'db4', 3)
+    if not np.array_equal (repeated, expected[0]):
+        raise ValueError ('repeated denoising doesnt match the first call')
+
+    # channels are denoised in parallel, each channel should be the same as for single channel method
+    DataFilter.perform_wavelet_denoising_multi (data, eeg_channels, 'db4', 3)
+    if not np.array_equal (data[eeg_channels], expected):
+        raise ValueError ('multichannel denoising doesnt match single channel denoising')
+    print ('multichannel denoising matches single channel denoising')
+
+
+if __name__ == "__main__":
+    main ()
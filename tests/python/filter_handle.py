@@ -0,0 +1,43 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds
+from brainflow.data_filter import DataFilter, FilterTypes, FilterOperations
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    sampling_rate = BoardShim.get_sampling_rate (board_id)
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    board.start_stream ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (5)
+    data = board.get_board_data ()
+    board.stop_stream ()
+    board.release_session ()
+
+    channel = BoardShim.get_eeg_channels (board_id)[1]
+    expected = np.copy (data[channel])
+    DataFilter.perform_bandpass (expected, sampling_rate, 15.0, 6.0, 4, FilterTypes.BUTTERWORTH.value, 0)
+    # filter handle keeps its state between calls, so data can be filtered chunk by chunk as it comes
+    # from the board, result should be the same as for the whole array
+    filter_id = DataFilter.create_filter (FilterOperations.BANDPASS.value, sampling_rate, 15.0, 6.0, 4,
+        FilterTypes.BUTTERWORTH.value, 0)
+    chunk_size = 37
+    for i in range (0, data.shape[1], chunk_size):
+        DataFilter.process_filter (filter_id, data[channel][i:i + chunk_size])
+    DataFilter.release_filter (filter_id)
+    if not np.allclose (data[channel], expected):
+        raise ValueError ('chunked filter doesnt match one-shot filter')
+    print ('chunked filter matches one-shot filter')
+
+
+if __name__ == "__main__":
+    main ()
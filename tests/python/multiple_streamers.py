@@ -0,0 +1,42 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds, BrainFlowError
+from brainflow.data_filter import DataFilter
+from brainflow.exit_codes import BrainflowExitCodes
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    # several streamers are separated by ';', each of them gets all samples
+    board.start_stream (45000, 'file://streamer_a.csv:w;file://streamer_b.csv:w')
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (3)
+    board.stop_stream ()
+    data = board.get_board_data ()
+    # if one of streamers is invalid stream should not be started
+    try:
+        board.start_stream (45000, 'file://streamer_c.csv:w;file:/streamer_d.csv')
+        raise ValueError ('stream was started with invalid streamer')
+    except BrainFlowError as err:
+        if err.exit_code != BrainflowExitCodes.INVALID_ARGUMENTS_ERROR.value:
+            raise
+    board.release_session ()
+
+    first_file = DataFilter.read_file ('streamer_a.csv')
+    second_file = DataFilter.read_file ('streamer_b.csv')
+    print ('board data: %d first file: %d second file: %d' % (data.shape[1], first_file.shape[1], second_file.shape[1]))
+    if first_file.shape != data.shape or not np.array_equal (first_file, second_file):
+        raise ValueError ('files from streamers are different')
+
+
+if __name__ == "__main__":
+    main ()
@@ -0,0 +1,45 @@
+import argparse
+import brainflow
+import numpy as np
+
+from brainflow.data_filter import DataFilter, AggOperations
+
+
+def main ():
+    DataFilter.enable_dev_data_logger ()
+
+    # 10 Hz sine resampled from 200 Hz to 250 Hz should stay the same sine, edges are skipped
+    input_rate = 200
+    output_rate = 250
+    data = np.sin (2 * np.pi * 10 * np.arange (4 * input_rate) / input_rate)
+    resampled = DataFilter.perform_resampling (data, input_rate, output_rate)
+    expected = np.sin (2 * np.pi * 10 * np.arange (resampled.shape[0]) / output_rate)
+    resampling_diff = np.max (np.abs (resampled - expected)[50:-50])
+    print ('resampled len: %d max diff with 10 Hz sine: %f' % (resampled.shape[0], resampling_diff))
+    if resampled.shape[0] != 4 * output_rate or resampling_diff > 0.01:
+        raise ValueError ('resampling changed amplitude or frequency')
+    # output len is ceil (data_len * output_rate / input_rate)
+    for data_len in range (1, 20):
+        if DataFilter.get_resampled_len (data_len, input_rate, output_rate) != (data_len * output_rate + input_rate - 1) // input_rate:
+            raise ValueError ('wrong resampled len for %d' % data_len)
+        if DataFilter.perform_resampling (data[:data_len], input_rate, output_rate).shape[0] != DataFilter.get_resampled_len (data_len, input_rate, output_rate):
+            raise ValueError ('output len doesnt match get_resampled_len for %d' % data_len)
+
+    # 5 Hz sine with 40 Hz noise, after decimation from 250 Hz to 50 Hz noise is above the new Nyquist frequency,
+    # FIR decimation removes it while EACH folds it to 10 Hz
+    period = 5
+    input_rate = 250
+    t = np.arange (4 * input_rate) / input_rate
+    data = np.sin (2 * np.pi * 5 * t) + 0.5 * np.sin (2 * np.pi * 40 * t)
+    decimated = DataFilter.perform_downsampling (data, period, AggOperations.FIR_DECIMATION.value)
+    each = DataFilter.perform_downsampling (data, period, AggOperations.EACH.value)
+    expected = np.sin (2 * np.pi * 5 * np.arange (decimated.shape[0]) * period / input_rate)
+    decimation_diff = np.max (np.abs (decimated - expected)[10:-10])
+    each_diff = np.max (np.abs (each - expected)[10:-10])
+    print ('max diff with 5 Hz sine, fir decimation: %f each: %f' % (decimation_diff, each_diff))
+    if decimation_diff > 0.05 or each_diff < 0.4:
+        raise ValueError ('fir decimation doesnt attenuate frequencies above new Nyquist')
+
+
+if __name__ == "__main__":
+    main ()
@@ -0,0 +1,42 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds
+from brainflow.data_filter import DataFilter, AggOperations
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    board.start_stream ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (5)
+    data = board.get_board_data ()
+    board.stop_stream ()
+    board.release_session ()
+
+    eeg_channels = BoardShim.get_eeg_channels (board_id)
+    for channel, operation in zip (eeg_channels, [AggOperations.MEAN.value, AggOperations.MEDIAN.value]):
+        expected = np.copy (data[channel])
+        DataFilter.perform_rolling_filter (expected, 3, operation)
+        # rolling filter handle keeps its window between calls, so data can be smoothed chunk by chunk
+        # as it comes from the board, result should be the same as for the whole array
+        filter_id = DataFilter.create_rolling_filter (3, operation)
+        chunk_size = 37
+        for i in range (0, data.shape[1], chunk_size):
+            DataFilter.process_rolling_filter (filter_id, data[channel][i:i + chunk_size])
+        DataFilter.release_rolling_filter (filter_id)
+        if not np.allclose (data[channel], expected):
+            raise ValueError ('chunked rolling filter doesnt match one-shot filter for operation %d' % operation)
+    print ('chunked rolling filters match one-shot filters')
+
+
+if __name__ == "__main__":
+    main ()
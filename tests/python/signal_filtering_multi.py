@@ -0,0 +1,48 @@
+import argparse
+import time
+import brainflow
+import numpy as np
+
+from brainflow.board_shim import BoardShim, BrainFlowInputParams, LogLevels, BoardIds
+from brainflow.data_filter import DataFilter, FilterTypes, WindowFunctions
+
+
+def main ():
+    BoardShim.enable_dev_board_logger ()
+
+    # use synthetic board for demo
+    params = BrainFlowInputParams ()
+    board_id = BoardIds.SYNTHETIC_BOARD.value
+    sampling_rate = BoardShim.get_sampling_rate (board_id)
+    board = BoardShim (board_id, params)
+    board.prepare_session ()
+    board.start_stream ()
+    BoardShim.log_message (LogLevels.LEVEL_INFO.value, 'start sleeping in the main thread')
+    time.sleep (10)
+    data = board.get_board_data ()
+    board.stop_stream ()
+    board.release_session ()
+
+    eeg_channels = BoardShim.get_eeg_channels (board_id)
+    # multichannel methods process all channels with a single call, results should be the same
+    # as for per channel methods
+    expected = np.copy (data)
+    for channel in eeg_channels:
+        DataFilter.perform_bandpass (expected[channel], sampling_rate, 15.0, 6.0, 4, FilterTypes.BUTTERWORTH.value, 0)
+        DataFilter.perform_bandstop (expected[channel], sampling_rate, 50.0, 4.0, 4, FilterTypes.BUTTERWORTH.value, 0)
+    DataFilter.perform_bandpass_multi (data, eeg_channels, sampling_rate, 15.0, 6.0, 4, FilterTypes.BUTTERWORTH.value, 0)
+    DataFilter.perform_bandstop_multi (data, eeg_channels, sampling_rate, 50.0, 4.0, 4, FilterTypes.BUTTERWORTH.value, 0)
+    if not np.allclose (data, expected):
+        raise ValueError ('multichannel filters dont match per channel filters')
+
+    nfft = DataFilter.get_nearest_power_of_two (sampling_rate)
+    ampls, freqs = DataFilter.get_psd_welch_multi (data, eeg_channels, nfft, nfft // 2, sampling_rate, WindowFunctions.HANNING.value)
+    for i, channel in enumerate (eeg_channels):
+        psd = DataFilter.get_psd_welch (data[channel], nfft, nfft // 2, sampling_rate, WindowFunctions.HANNING.value)
+        if (not np.allclose (ampls[i], psd[0])) or (not np.allclose (freqs, psd[1])):
+            raise ValueError ('multichannel psd doesnt match psd for channel %d' % channel)
+    print ('multichannel methods match per channel methods')
+
+
+if __name__ == "__main__":
+    main ()